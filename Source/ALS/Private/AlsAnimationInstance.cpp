@@ -2,17 +2,32 @@
 
 #include "AlsAnimationInstanceProxy.h"
 #include "AlsCharacter.h"
-#include "DrawDebugHelpers.h"
-#include "Components/CapsuleComponent.h"
+#include "AlsCharacterMovementComponent.h"
 #include "Curves/CurveFloat.h"
-#include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/AlsAnimationInstanceSettings.h"
 #include "Utility/AlsConstants.h"
+#include "Utility/AlsDebugDrawSubsystem.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsUtility.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimationInstance)
 
+namespace AlsAnimationInstanceTurnInPlace
+{
+	// Turn in place settings indexed by stance (standing, crouching), turn angle (90, 180) and direction (right, left).
+	static constexpr TObjectPtr<UAlsTurnInPlaceSettings> FAlsGeneralTurnInPlaceSettings::* SettingsTable[2][2][2]
+	{
+		{
+			{&FAlsGeneralTurnInPlaceSettings::StandingTurn90Right, &FAlsGeneralTurnInPlaceSettings::StandingTurn90Left},
+			{&FAlsGeneralTurnInPlaceSettings::StandingTurn180Right, &FAlsGeneralTurnInPlaceSettings::StandingTurn180Left}
+		},
+		{
+			{&FAlsGeneralTurnInPlaceSettings::CrouchingTurn90Right, &FAlsGeneralTurnInPlaceSettings::CrouchingTurn90Left},
+			{&FAlsGeneralTurnInPlaceSettings::CrouchingTurn180Right, &FAlsGeneralTurnInPlaceSettings::CrouchingTurn180Left}
+		}
+	};
+}
+
 void UAlsAnimationInstance::NativeInitializeAnimation()
 {
 	Super::NativeInitializeAnimation();
@@ -54,6 +69,8 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 
 	Character->FinalizeRagdolling();
 
+	RefreshFrozenPoseOnGameThread(DeltaTime);
+
 	if (GetSkelMeshComponent()->IsUsingAbsoluteRotation())
 	{
 		const auto& ActorTransform{Character->GetActorTransform()};
@@ -74,8 +91,15 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
 	bDisplayDebugTraces = UAlsUtility::ShouldDisplayDebugForActor(Character, UAlsConstants::TracesDebugDisplayName());
+	DebugDrawSubsystem = bDisplayDebugTraces ? GetWorld()->GetSubsystem<UAlsDebugDrawSubsystem>() : nullptr;
 #endif
 
+	auto bStateChanged{
+		ViewMode != Character->GetViewMode() || LocomotionMode != Character->GetLocomotionMode() ||
+		RotationMode != Character->GetRotationMode() || Stance != Character->GetStance() ||
+		Gait != Character->GetGait() || OverlayMode != Character->GetOverlayMode()
+	};
+
 	ViewMode = Character->GetViewMode();
 	LocomotionMode = Character->GetLocomotionMode();
 	RotationMode = Character->GetRotationMode();
@@ -88,6 +112,8 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 		LocomotionAction = Character->GetLocomotionAction();
 
 		ResetGroundedEntryMode();
+
+		bStateChanged = true;
 	}
 
 	RefreshMovementBaseOnGameThread();
@@ -99,6 +125,8 @@ void UAlsAnimationInstance::NativeUpdateAnimation(const float DeltaTime)
 	RefreshFeetOnGameThread();
 
 	RefreshRagdollingOnGameThread();
+
+	RefreshIdleOnGameThread(DeltaTime, bStateChanged);
 }
 
 void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTime)
@@ -108,23 +136,38 @@ void UAlsAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTim
 
 	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
 
-	if (!IsValid(Settings) || !IsValid(Character))
+	if (!IsValid(Settings) || !IsValid(Character) || IdleState.bUpdateSkipped)
 	{
 		return;
 	}
 
+	// Catch up on the time of the frames skipped while the character was idle.
+
+	const auto UpdateDeltaTime{DeltaTime + IdleState.SkippedDeltaTime};
+
 	RefreshLayering();
 	RefreshPose();
 
-	RefreshView(DeltaTime);
-	RefreshGrounded(DeltaTime);
-	RefreshInAir(DeltaTime);
+	RefreshView(UpdateDeltaTime);
+	RefreshGrounded(UpdateDeltaTime);
+	RefreshInAir(UpdateDeltaTime);
+
+	RefreshFeet(UpdateDeltaTime);
+
+	// Transitions, rotate in place and turn in place can only be activated while the character is stationary.
 
-	RefreshFeet(DeltaTime);
+	if (LocomotionState.bStationary)
+	{
+		RefreshTransitions();
+		RefreshRotateInPlace(UpdateDeltaTime);
+		RefreshTurnInPlace(UpdateDeltaTime);
+	}
+	else
+	{
+		ResetTransitionsAndInPlaceRotations();
+	}
 
-	RefreshTransitions();
-	RefreshRotateInPlace(DeltaTime);
-	RefreshTurnInPlace(DeltaTime);
+	UpdateRevision += 1;
 }
 
 void UAlsAnimationInstance::NativePostUpdateAnimation()
@@ -144,18 +187,6 @@ void UAlsAnimationInstance::NativePostUpdateAnimation()
 	PlayQueuedTurnInPlaceAnimation();
 	StopQueuedTransitionAndTurnInPlaceAnimations();
 
-#if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
-	if (!bPendingUpdate)
-	{
-		for (const auto& DisplayDebugTraceFunction : DisplayDebugTracesQueue)
-		{
-			DisplayDebugTraceFunction();
-		}
-	}
-
-	DisplayDebugTracesQueue.Reset();
-#endif
-
 	bPendingUpdate = false;
 }
 
@@ -210,6 +241,113 @@ void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
 		                             : FRotator::ZeroRotator;
 }
 
+void UAlsAnimationInstance::RefreshIdleOnGameThread(const float DeltaTime, const bool bStateChanged)
+{
+	check(IsInGameThread())
+
+	if (!IdleState.bUpdateSkipped)
+	{
+		// The skipped time has already been consumed by the previous state update.
+
+		IdleState.SkippedDeltaTime = 0.0f;
+	}
+
+	if (bStateChanged || !Settings->General.bAllowIdleUpdateRateReduction || !IsFullyIdle())
+	{
+		WakeFromIdle();
+
+		IdleState.bUpdateSkipped = false;
+		IdleState.ViewRotation = ViewState.Rotation;
+		return;
+	}
+
+	IdleState.IdleTime += DeltaTime;
+	IdleState.bIdle = IdleState.IdleTime >= Settings->General.IdleUpdateRateReductionDelay;
+
+	if (!IdleState.bIdle)
+	{
+		IdleState.bUpdateSkipped = false;
+		return;
+	}
+
+	// While idle, the thread-safe state update runs only once every few frames. The animation graph is still
+	// evaluated every frame, so idle animations keep playing, and the state values are held in between updates.
+
+	IdleState.SkippedFramesCount += 1;
+
+	if (IdleState.SkippedFramesCount < Settings->General.IdleUpdateInterval)
+	{
+		IdleState.bUpdateSkipped = true;
+		IdleState.SkippedDeltaTime += DeltaTime;
+	}
+	else
+	{
+		IdleState.bUpdateSkipped = false;
+		IdleState.SkippedFramesCount = 0;
+	}
+}
+
+bool UAlsAnimationInstance::IsFullyIdle() const
+{
+	return !bPendingUpdate && LocomotionMode == AlsLocomotionModeTags::Grounded && !LocomotionAction.IsValid() &&
+	       !LocomotionState.bHasInput && !LocomotionState.bMoving &&
+	       FMath::IsNearlyZero(LocomotionState.YawSpeed) && FMath::IsNearlyZero(ViewState.YawSpeed) &&
+	       ViewState.Rotation.Equals(IdleState.ViewRotation) &&
+	       !MovementBase.bBaseChanged && MovementBase.DeltaRotation.IsNearlyZero() &&
+	       !IsAnyMontagePlaying();
+}
+
+bool UAlsAnimationInstance::ShouldFreezePose() const
+{
+	check(IsInGameThread())
+
+	return IsValid(Settings) && Settings->General.bAllowPoseFreezing && !LocomotionAction.IsValid() && !IsAnyMontagePlaying() &&
+	       !GetSkelMeshComponent()->WasRecentlyRendered(Settings->General.PoseFreezingDelay);
+}
+
+void UAlsAnimationInstance::FreezePose()
+{
+	check(IsInGameThread())
+
+	if (FrozenPoseState.bFrozen)
+	{
+		return;
+	}
+
+	// Save a snapshot of the last evaluated pose for use in animation graph to blend out of the frozen pose.
+
+	SnapshotPose(FrozenPoseState.Pose);
+
+	FrozenPoseState.bFrozen = true;
+	FrozenPoseState.BlendAmount = 0.0f;
+
+	MarkPendingUpdate();
+}
+
+void UAlsAnimationInstance::RefreshFrozenPoseOnGameThread(const float DeltaTime)
+{
+	check(IsInGameThread())
+
+	if (FrozenPoseState.bFrozen)
+	{
+		// The animation instance is updated again, so the character has become visible.
+
+		FrozenPoseState.bFrozen = false;
+		FrozenPoseState.BlendAmount = FrozenPoseState.Pose.bIsValid && Settings->General.PoseUnfreezingBlendDuration > UE_SMALL_NUMBER
+			                              ? 1.0f
+			                              : 0.0f;
+		return;
+	}
+
+	if (FrozenPoseState.BlendAmount > 0.0f)
+	{
+		FrozenPoseState.BlendAmount = Settings->General.PoseUnfreezingBlendDuration > UE_SMALL_NUMBER
+			                              ? FMath::Max(0.0f, FrozenPoseState.BlendAmount -
+			                                                 DeltaTime / Settings->General.PoseUnfreezingBlendDuration)
+			                              : 0.0f;
+	}
+}
+
 void UAlsAnimationInstance::RefreshLayering()
 {
 	const auto& Curves{GetProxyOnAnyThread<FAlsAnimationInstanceProxy>().GetAnimationCurves(EAnimCurveType::AttributeCurve)};
@@ -469,17 +607,19 @@ void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 	LocomotionState.VelocityYawAngle = Locomotion.VelocityYawAngle;
 	LocomotionState.Acceleration = Locomotion.Acceleration;
 
-	const auto* Movement{Character->GetCharacterMovement()};
+	const auto& DerivedMovement{Character->GetAlsCharacterMovement()->GetDerivedState()};
 
-	LocomotionState.MaxAcceleration = Movement->GetMaxAcceleration();
-	LocomotionState.MaxBrakingDeceleration = Movement->GetMaxBrakingDeceleration();
-	LocomotionState.WalkableFloorZ = Movement->GetWalkableFloorZ();
+	LocomotionState.MaxAcceleration = DerivedMovement.MaxAcceleration;
+	LocomotionState.MaxBrakingDeceleration = DerivedMovement.MaxBrakingDeceleration;
+	LocomotionState.WalkableFloorZ = DerivedMovement.WalkableFloorZ;
 
 	LocomotionState.bMoving = Locomotion.bMoving;
 
 	LocomotionState.bMovingSmooth = (Locomotion.bHasInput && Locomotion.bHasSpeed) ||
 	                                Locomotion.Speed > Settings->General.MovingSmoothSpeedThreshold;
 
+	LocomotionState.bStationary = !Locomotion.bMoving && LocomotionMode == AlsLocomotionModeTags::Grounded;
+
 	LocomotionState.TargetYawAngle = Locomotion.TargetYawAngle;
 	LocomotionState.Location = Locomotion.Location;
 	LocomotionState.Rotation = Locomotion.Rotation;
@@ -488,10 +628,8 @@ void UAlsAnimationInstance::RefreshLocomotionOnGameThread()
 
 	LocomotionState.Scale = UE_REAL_TO_FLOAT(GetSkelMeshComponent()->GetComponentScale().Z);
 
-	const auto* Capsule{Character->GetCapsuleComponent()};
-
-	LocomotionState.CapsuleRadius = Capsule->GetScaledCapsuleRadius();
-	LocomotionState.CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	LocomotionState.CapsuleRadius = DerivedMovement.CapsuleRadius;
+	LocomotionState.CapsuleHalfHeight = DerivedMovement.CapsuleHalfHeight;
 }
 
 void UAlsAnimationInstance::RefreshGroundedOnGameThread()
@@ -834,24 +972,11 @@ void UAlsAnimationInstance::RefreshGroundPredictionAmount()
 	const auto bGroundValid{Hit.IsValidBlockingHit() && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorZ};
 
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
-	if (bDisplayDebugTraces)
+	if (bDisplayDebugTraces && IsValid(DebugDrawSubsystem))
 	{
-		if (IsInGameThread())
-		{
-			UAlsUtility::DrawDebugSweepSingleCapsule(GetWorld(), Hit.TraceStart, Hit.TraceEnd, FRotator::ZeroRotator,
-			                                         LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
-			                                         bGroundValid, Hit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f});
-		}
-		else
-		{
-			DisplayDebugTracesQueue.Emplace([this, Hit, bGroundValid]
-				{
-					UAlsUtility::DrawDebugSweepSingleCapsule(GetWorld(), Hit.TraceStart, Hit.TraceEnd, FRotator::ZeroRotator,
-					                                         LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
-					                                         bGroundValid, Hit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f});
-				}
-			);
-		}
+		DebugDrawSubsystem->QueueSweepSingleCapsule(Hit.TraceStart, Hit.TraceEnd, FQuat::Identity,
+		                                            LocomotionState.CapsuleRadius, LocomotionState.CapsuleHalfHeight,
+		                                            bGroundValid, Hit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f});
 	}
 #endif
 
@@ -927,11 +1052,27 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 
 	const auto ComponentTransformInverse{GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().Inverse()};
 
+	FVector FinalLocations[2];
+	FQuat FinalRotations[2];
+
 	RefreshFoot(FeetState.Left, UAlsConstants::FootLeftIkCurveName(), UAlsConstants::FootLeftLockCurveName(),
-	            Settings->Feet.LeftFootLimits, ComponentTransformInverse, DeltaTime);
+	            Settings->Feet.LeftFootLimits, ComponentTransformInverse, DeltaTime, FinalLocations[0], FinalRotations[0]);
 
 	RefreshFoot(FeetState.Right, UAlsConstants::FootRightIkCurveName(), UAlsConstants::FootRightLockCurveName(),
-	            Settings->Feet.RightFootLimits, ComponentTransformInverse, DeltaTime);
+	            Settings->Feet.RightFootLimits, ComponentTransformInverse, DeltaTime, FinalLocations[1], FinalRotations[1]);
+
+	// Both feet are transformed to component space together, so the component transform is loaded into vector registers only once.
+
+	FVector IkLocations[2];
+	FQuat IkRotations[2];
+
+	UAlsMath::TransformLocationsAndRotations(ComponentTransformInverse, FinalLocations, FinalRotations, IkLocations, IkRotations);
+
+	FeetState.Left.IkLocation = IkLocations[0];
+	FeetState.Left.IkRotation = IkRotations[0];
+
+	FeetState.Right.IkLocation = IkLocations[1];
+	FeetState.Right.IkRotation = IkRotations[1];
 
 	FeetState.MinMaxPelvisOffsetZ.X = UE_REAL_TO_FLOAT(
 		FMath::Min(FeetState.Left.OffsetTargetLocationZ, FeetState.Right.OffsetTargetLocationZ) / LocomotionState.Scale);
@@ -942,7 +1083,8 @@ void UAlsAnimationInstance::RefreshFeet(const float DeltaTime)
 
 void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& FootIkCurveName,
                                         const FName& FootLockCurveName, const FAlsFootLimitsSettings& LimitsSettings,
-                                        const FTransform& ComponentTransformInverse, const float DeltaTime) const
+                                        const FTransform& ComponentTransformInverse, const float DeltaTime,
+                                        FVector& FinalLocation, FQuat& FinalRotation) const
 {
 	FootState.IkAmount = GetCurveValueClamped01(FootIkCurveName);
 
@@ -950,8 +1092,8 @@ void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& F
 
 	ProcessFootLockBaseChange(FootState, ComponentTransformInverse);
 
-	auto FinalLocation{FootState.TargetLocation};
-	auto FinalRotation{FootState.TargetRotation};
+	FinalLocation = FootState.TargetLocation;
+	FinalRotation = FootState.TargetRotation;
 
 	RefreshFootLock(FootState, FootLockCurveName, ComponentTransformInverse, DeltaTime, FinalLocation, FinalRotation);
 
@@ -962,9 +1104,6 @@ void UAlsAnimationInstance::RefreshFoot(FAlsFootState& FootState, const FName& F
 	// sloped surface by limiting its rotation after applying a foot offset.
 
 	LimitFootRotation(LimitsSettings, PreviousFinalRotation, FinalRotation);
-
-	FootState.IkLocation = ComponentTransformInverse.TransformPosition(FinalLocation);
-	FootState.IkRotation = ComponentTransformInverse.TransformRotation(FinalRotation);
 }
 
 void UAlsAnimationInstance::ProcessFootLockTeleport(FAlsFootState& FootState) const
@@ -1186,6 +1325,9 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 		FinalLocation.X, FinalLocation.Y, GetProxyOnAnyThread<FAnimInstanceProxy>().GetComponentTransform().GetLocation().Z
 	};
 
+	FCollisionQueryParams QueryParameters{__FUNCTION__, true, Character};
+	QueryParameters.bReturnPhysicalMaterial = Settings->Feet.bReturnIkTracePhysicalMaterial;
+
 	FHitResult Hit;
 	GetWorld()->LineTraceSingleByChannel(Hit,
 	                                     TraceLocation + FVector{
@@ -1194,27 +1336,21 @@ void UAlsAnimationInstance::RefreshFootOffset(FAlsFootState& FootState, const fl
 	                                     TraceLocation - FVector{
 		                                     0.0f, 0.0f, Settings->Feet.IkTraceDistanceDownward * LocomotionState.Scale
 	                                     },
-	                                     Settings->Feet.IkTraceChannel, {__FUNCTION__, true, Character});
+	                                     Settings->Feet.IkTraceChannel, QueryParameters);
+
+	if (Settings->Feet.bReturnIkTracePhysicalMaterial)
+	{
+		FootState.GroundHit = Hit;
+		FootState.GroundHitTime = GetWorld()->GetTimeSeconds();
+	}
 
 	const auto bGroundValid{Hit.IsValidBlockingHit() && Hit.ImpactNormal.Z >= LocomotionState.WalkableFloorZ};
 
 #if WITH_EDITORONLY_DATA && ENABLE_DRAW_DEBUG
-	if (bDisplayDebugTraces)
+	if (bDisplayDebugTraces && IsValid(DebugDrawSubsystem))
 	{
-		if (IsInGameThread())
-		{
-			UAlsUtility::DrawDebugLineTraceSingle(GetWorld(), Hit.TraceStart, Hit.TraceEnd, bGroundValid,
-			                                      Hit, {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f});
-		}
-		else
-		{
-			DisplayDebugTracesQueue.Emplace([this, Hit, bGroundValid]
-				{
-					UAlsUtility::DrawDebugLineTraceSingle(GetWorld(), Hit.TraceStart, Hit.TraceEnd, bGroundValid,
-					                                      Hit, {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f});
-				}
-			);
-		}
+		DebugDrawSubsystem->QueueLineTraceSingle(Hit.TraceStart, Hit.TraceEnd, bGroundValid,
+		                                         Hit, {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f});
 	}
 #endif
 
@@ -1407,6 +1543,19 @@ void UAlsAnimationInstance::StopTransitionAndTurnInPlaceAnimations(const float B
 	}
 }
 
+void UAlsAnimationInstance::ResetTransitionsAndInPlaceRotations()
+{
+	TransitionsState.bTransitionsAllowed = false;
+
+	RotateInPlaceState.bRotatingLeft = false;
+	RotateInPlaceState.bRotatingRight = false;
+	RotateInPlaceState.PlayRate = Settings->RotateInPlace.PlayRate.X;
+	RotateInPlaceState.bFootLockInhibited = false;
+
+	TurnInPlaceState.ActivationDelay = 0.0f;
+	TurnInPlaceState.bFootLockInhibited = false;
+}
+
 void UAlsAnimationInstance::RefreshTransitions()
 {
 	// The allow transitions curve is modified within certain states, so that transitions allowed will be true while in those states.
@@ -1424,7 +1573,7 @@ void UAlsAnimationInstance::RefreshDynamicTransition()
 		return;
 	}
 
-	if (!TransitionsState.bTransitionsAllowed || LocomotionState.bMoving || LocomotionMode != AlsLocomotionModeTags::Grounded)
+	if (!TransitionsState.bTransitionsAllowed)
 	{
 		return;
 	}
@@ -1551,7 +1700,7 @@ void UAlsAnimationInstance::RefreshRotateInPlace(const float DeltaTime)
 
 	// Rotate in place is allowed only if the character is standing still and aiming or in first-person view mode.
 
-	if (LocomotionState.bMoving || LocomotionMode != AlsLocomotionModeTags::Grounded || !IsRotateInPlaceAllowed())
+	if (!IsRotateInPlaceAllowed())
 	{
 		RotateInPlaceState.bRotatingLeft = false;
 		RotateInPlaceState.bRotatingRight = false;
@@ -1612,7 +1761,7 @@ void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 	// Turn in place is allowed only if transitions are allowed, the character
 	// standing still and looking at the camera and not in first-person mode.
 
-	if (LocomotionState.bMoving || LocomotionMode != AlsLocomotionModeTags::Grounded || !IsTurnInPlaceAllowed())
+	if (!IsTurnInPlaceAllowed())
 	{
 		TurnInPlaceState.ActivationDelay = 0.0f;
 		TurnInPlaceState.bFootLockInhibited = false;
@@ -1656,47 +1805,33 @@ void UAlsAnimationInstance::RefreshTurnInPlace(const float DeltaTime)
 
 	// Select settings based on turn angle and stance.
 
-	UAlsTurnInPlaceSettings* TurnInPlaceSettings{nullptr};
+	int32 StanceIndex;
 	FName TurnInPlaceSlotName;
 
 	if (Stance == AlsStanceTags::Standing)
 	{
+		StanceIndex = 0;
 		TurnInPlaceSlotName = UAlsConstants::TurnInPlaceStandingSlotName();
-
-		if (FMath::Abs(ViewState.YawAngle) < Settings->TurnInPlace.Turn180AngleThreshold)
-		{
-			TurnInPlaceSettings = ViewState.YawAngle <= 0.0f ||
-			                      ViewState.YawAngle > 180.0f - UAlsMath::CounterClockwiseRotationAngleThreshold
-				                      ? Settings->TurnInPlace.StandingTurn90Left
-				                      : Settings->TurnInPlace.StandingTurn90Right;
-		}
-		else
-		{
-			TurnInPlaceSettings = ViewState.YawAngle <= 0.0f ||
-			                      ViewState.YawAngle > 180.0f - UAlsMath::CounterClockwiseRotationAngleThreshold
-				                      ? Settings->TurnInPlace.StandingTurn180Left
-				                      : Settings->TurnInPlace.StandingTurn180Right;
-		}
 	}
 	else if (Stance == AlsStanceTags::Crouching)
 	{
+		StanceIndex = 1;
 		TurnInPlaceSlotName = UAlsConstants::TurnInPlaceCrouchingSlotName();
-
-		if (FMath::Abs(ViewState.YawAngle) < Settings->TurnInPlace.Turn180AngleThreshold)
-		{
-			TurnInPlaceSettings = ViewState.YawAngle <= 0.0f ||
-			                      ViewState.YawAngle > 180.0f - UAlsMath::CounterClockwiseRotationAngleThreshold
-				                      ? Settings->TurnInPlace.CrouchingTurn90Left
-				                      : Settings->TurnInPlace.CrouchingTurn90Right;
-		}
-		else
-		{
-			TurnInPlaceSettings = ViewState.YawAngle <= 0.0f ||
-			                      ViewState.YawAngle > 180.0f - UAlsMath::CounterClockwiseRotationAngleThreshold
-				                      ? Settings->TurnInPlace.CrouchingTurn180Left
-				                      : Settings->TurnInPlace.CrouchingTurn180Right;
-		}
 	}
+	else
+	{
+		return;
+	}
+
+	const auto bTurn180{FMath::Abs(ViewState.YawAngle) >= Settings->TurnInPlace.Turn180AngleThreshold};
+
+	const auto bTurnLeft{
+		ViewState.YawAngle <= 0.0f || ViewState.YawAngle > 180.0f - UAlsMath::CounterClockwiseRotationAngleThreshold
+	};
+
+	auto* TurnInPlaceSettings{
+		(Settings->TurnInPlace.*AlsAnimationInstanceTurnInPlace::SettingsTable[StanceIndex][bTurn180 ? 1 : 0][bTurnLeft ? 1 : 0]).Get()
+	};
 
 	if (IsValid(TurnInPlaceSettings) && ALS_ENSURE(IsValid(TurnInPlaceSettings->Animation)))
 	{
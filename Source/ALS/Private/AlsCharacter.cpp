@@ -261,6 +261,7 @@ void AAlsCharacter::Tick(const float DeltaTime)
 	if (!IsValid(Settings) || !AnimationInstance.IsValid())
 	{
 		Super::Tick(DeltaTime);
+		SendDesiredStateRpc();
 		return;
 	}
 
@@ -288,6 +289,8 @@ void AAlsCharacter::Tick(const float DeltaTime)
 	Super::Tick(DeltaTime);
 
 	RefreshLocomotionLate(DeltaTime);
+
+	SendDesiredStateRpc();
 }
 
 void AAlsCharacter::PossessedBy(AController* NewController)
@@ -332,7 +335,21 @@ void AAlsCharacter::RefreshMeshProperties() const
 
 	// Keep the default tick option, at least if the target tick option is not required by the plugin to work properly.
 
-	GetMesh()->VisibilityBasedAnimTickOption = FMath::Min(TargetTickOption, DefaultTickOption);
+	auto NewTickOption{FMath::Min(TargetTickOption, DefaultTickOption)};
+
+	// Stop updating and evaluating the animation instance of simulated proxies entirely if they haven't been rendered for a while.
+
+	const auto bFreezePose{
+		NewTickOption == EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered &&
+		GetLocalRole() == ROLE_SimulatedProxy && AnimationInstance->ShouldFreezePose()
+	};
+
+	if (bFreezePose)
+	{
+		NewTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+	}
+
+	GetMesh()->VisibilityBasedAnimTickOption = NewTickOption;
 
 	const auto bMeshIsTicking{
 		GetMesh()->bRecentlyRendered || GetMesh()->VisibilityBasedAnimTickOption <= EVisibilityBasedAnimTickOption::AlwaysTickPose
@@ -367,7 +384,11 @@ void AAlsCharacter::RefreshMeshProperties() const
 		GetMesh()->SetUsingAbsoluteRotation(bUseAbsoluteRotation);
 	}
 
-	if (!bMeshIsTicking)
+	if (bFreezePose)
+	{
+		AnimationInstance->FreezePose();
+	}
+	else if (!bMeshIsTicking)
 	{
 		AnimationInstance->MarkPendingUpdate();
 	}
@@ -410,7 +431,7 @@ void AAlsCharacter::SetViewMode(const FGameplayTag& NewViewMode, const bool bSen
 
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ViewMode, this)
 
-	if (bSendRpc)
+	if (bSendRpc && !QueueDesiredStateRpc(EAlsDesiredStateFlags::ViewMode))
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
@@ -528,7 +549,7 @@ void AAlsCharacter::SetDesiredAiming(const bool bNewDesiredAiming, const bool bS
 
 	K2_OnDesiredAimingChanged(!bDesiredAiming);
 
-	if (bSendRpc)
+	if (bSendRpc && !QueueDesiredStateRpc(EAlsDesiredStateFlags::DesiredAiming))
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
@@ -552,7 +573,7 @@ void AAlsCharacter::SetDesiredRotationMode(const FGameplayTag& NewDesiredRotatio
 
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredRotationMode, this)
 
-	if (bSendRpc)
+	if (bSendRpc && !QueueDesiredStateRpc(EAlsDesiredStateFlags::DesiredRotationMode))
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
@@ -679,7 +700,7 @@ void AAlsCharacter::SetDesiredStance(const FGameplayTag& NewDesiredStance, const
 
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredStance, this)
 
-	if (bSendRpc)
+	if (bSendRpc && !QueueDesiredStateRpc(EAlsDesiredStateFlags::DesiredStance))
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
@@ -785,7 +806,7 @@ void AAlsCharacter::SetDesiredGait(const FGameplayTag& NewDesiredGait, const boo
 
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, DesiredGait, this)
 
-	if (bSendRpc)
+	if (bSendRpc && !QueueDesiredStateRpc(EAlsDesiredStateFlags::DesiredGait))
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
@@ -908,7 +929,7 @@ void AAlsCharacter::SetOverlayMode(const FGameplayTag& NewOverlayMode, const boo
 
 	K2_OnOverlayModeChanged(PreviousOverlayMode);
 
-	if (bSendRpc)
+	if (bSendRpc && !QueueDesiredStateRpc(EAlsDesiredStateFlags::OverlayMode))
 	{
 		if (GetLocalRole() >= ROLE_Authority)
 		{
@@ -964,16 +985,138 @@ void AAlsCharacter::RefreshInput(const float DeltaTime)
 
 void AAlsCharacter::SetReplicatedViewRotation(const FRotator& NewViewRotation, const bool bSendRpc)
 {
-	if (!ReplicatedViewRotation.Equals(NewViewRotation))
+	// The local value is always kept up to date, since the locally controlled character uses it as its view rotation.
+
+	ReplicatedViewRotation = NewViewRotation;
+
+	const auto CompressedPitch{FRotator::CompressAxisToShort(NewViewRotation.Pitch)};
+	const auto CompressedYaw{FRotator::CompressAxisToShort(NewViewRotation.Yaw)};
+
+	const FRotator QuantizedViewRotation{
+		FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(CompressedPitch)),
+		FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(CompressedYaw)),
+		0.0f
+	};
+
+	const auto AngleThreshold{IsValid(Settings) ? Settings->View.ReplicationAngleThreshold : 0.0f};
+
+	if (FMath::Abs(FRotator::NormalizeAxis(QuantizedViewRotation.Pitch - NetViewRotation.Pitch)) <= AngleThreshold &&
+	    FMath::Abs(FRotator::NormalizeAxis(QuantizedViewRotation.Yaw - NetViewRotation.Yaw)) <= AngleThreshold)
+	{
+		return;
+	}
+
+	if (bSendRpc && GetLocalRole() == ROLE_AutonomousProxy)
 	{
-		ReplicatedViewRotation = NewViewRotation;
+		const auto WorldTime{GetWorld()->GetTimeSeconds()};
+		const auto MaxSendRate{IsValid(Settings) ? Settings->View.MaxReplicationSendRate : 0.0f};
+
+		if (MaxSendRate > 0.0f && WorldTime - NetViewRotationSendTime < 1.0f / MaxSendRate)
+		{
+			// The change is not lost, it will be sent on one of the following frames.
+			return;
+		}
 
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedViewRotation, this)
+		NetViewRotationSendTime = WorldTime;
+
+		ServerSetReplicatedViewRotation(CompressedPitch, CompressedYaw);
+	}
+
+	NetViewRotation = QuantizedViewRotation;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedViewRotation, this)
+}
 
-		if (bSendRpc && GetLocalRole() == ROLE_AutonomousProxy)
+void AAlsCharacter::ServerSetReplicatedViewRotation_Implementation(const uint16 CompressedPitch, const uint16 CompressedYaw)
+{
+	SetReplicatedViewRotation({
+		FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(CompressedPitch)),
+		FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(CompressedYaw)),
+		0.0f
+	}, false);
+}
+
+bool AAlsCharacter::QueueDesiredStateRpc(const EAlsDesiredStateFlags Flag)
+{
+	// Pending changes are only sent from Tick(), so they would never be sent while the tick is disabled.
+
+	if (!IsValid(Settings) || !Settings->bCoalesceDesiredStateRpcs || !IsActorTickEnabled())
+	{
+		if (PendingDesiredStateFlags != EAlsDesiredStateFlags::None)
 		{
-			ServerSetReplicatedViewRotation(ReplicatedViewRotation);
+			// Changes queued before the tick was disabled must not arrive after this one.
+
+			SendDesiredStateRpc();
 		}
+
+		return false;
+	}
+
+	// Only the fact that the value has changed is remembered here, the current
+	// value itself is read when the RPC is sent at the end of the frame.
+
+	PendingDesiredStateFlags |= Flag;
+	return true;
+}
+
+void AAlsCharacter::SendDesiredStateRpc()
+{
+	if (PendingDesiredStateFlags == EAlsDesiredStateFlags::None)
+	{
+		return;
+	}
+
+	FAlsDesiredStateChanges Changes;
+	Changes.Flags = PendingDesiredStateFlags;
+	Changes.bDesiredAiming = bDesiredAiming;
+	Changes.DesiredRotationMode = DesiredRotationMode;
+	Changes.DesiredStance = DesiredStance;
+	Changes.DesiredGait = DesiredGait;
+	Changes.ViewMode = ViewMode;
+	Changes.OverlayMode = OverlayMode;
+
+	PendingDesiredStateFlags = EAlsDesiredStateFlags::None;
+
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		ClientSetDesiredState(Changes);
+	}
+	else if (GetLocalRole() == ROLE_AutonomousProxy)
+	{
+		ServerSetDesiredState(Changes);
+	}
+}
+
+void AAlsCharacter::ApplyDesiredStateChanges(const FAlsDesiredStateChanges& Changes)
+{
+	if (EnumHasAnyFlags(Changes.Flags, EAlsDesiredStateFlags::DesiredAiming))
+	{
+		SetDesiredAiming(Changes.bDesiredAiming, false);
+	}
+
+	if (EnumHasAnyFlags(Changes.Flags, EAlsDesiredStateFlags::DesiredRotationMode))
+	{
+		SetDesiredRotationMode(Changes.DesiredRotationMode, false);
+	}
+
+	if (EnumHasAnyFlags(Changes.Flags, EAlsDesiredStateFlags::DesiredStance))
+	{
+		SetDesiredStance(Changes.DesiredStance, false);
+	}
+
+	if (EnumHasAnyFlags(Changes.Flags, EAlsDesiredStateFlags::DesiredGait))
+	{
+		SetDesiredGait(Changes.DesiredGait, false);
+	}
+
+	if (EnumHasAnyFlags(Changes.Flags, EAlsDesiredStateFlags::ViewMode))
+	{
+		SetViewMode(Changes.ViewMode, false);
+	}
+
+	if (EnumHasAnyFlags(Changes.Flags, EAlsDesiredStateFlags::OverlayMode))
+	{
+		SetOverlayMode(Changes.OverlayMode, false);
 	}
 }
 
@@ -1019,10 +1162,15 @@ void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& NewTargetRotatio
 
 	const auto MaxServerDeltaTime{GetDefault<AGameNetworkManager>()->MaxClientSmoothingDeltaTime};
 
+	// The view rotation is not sent more often than the max send rate allows, so smooth over at least that interval.
+
+	const auto MaxSendRate{IsValid(Settings) ? Settings->View.MaxReplicationSendRate : 0.0f};
+
 	const auto MinServerDeltaTime{
-		FMath::Min(MaxServerDeltaTime, bListenServer
-			                               ? GetCharacterMovement()->ListenServerNetworkSimulatedSmoothLocationTime
-			                               : GetCharacterMovement()->NetworkSimulatedSmoothLocationTime)
+		FMath::Min(MaxServerDeltaTime, FMath::Max(bListenServer
+			                                          ? GetCharacterMovement()->ListenServerNetworkSimulatedSmoothLocationTime
+			                                          : GetCharacterMovement()->NetworkSimulatedSmoothLocationTime,
+		                                          MaxSendRate > 0.0f ? 1.0f / MaxSendRate : 0.0f))
 	};
 
 	// Calculate how far behind we can be after receiving a new server time.
@@ -1644,7 +1792,6 @@ void AAlsCharacter::RefreshViewRelativeTargetYawAngle()
 	LocomotionState.ViewRelativeTargetYawAngle = FRotator3f::NormalizeAxis(UE_REAL_TO_FLOAT(ViewState.Rotation.Yaw - LocomotionState.TargetYawAngle));
 }
 
-void AAlsCharacter::ServerSetReplicatedViewRotation_Implementation(const FRotator& NewViewRotation) { SetReplicatedViewRotation(NewViewRotation, false); }
 void AAlsCharacter::OnReplicated_ReplicatedViewRotation() { CorrectViewNetworkSmoothing(ReplicatedViewRotation, MovementBase.bHasRelativeRotation); }
 void AAlsCharacter::ClientSetOverlayMode_Implementation(const FGameplayTag& NewOverlayMode) { SetOverlayMode(NewOverlayMode, false); }
 void AAlsCharacter::ServerSetOverlayMode_Implementation(const FGameplayTag& NewOverlayMode) { SetOverlayMode(NewOverlayMode, false); }
@@ -1659,4 +1806,7 @@ void AAlsCharacter::ClientSetDesiredAiming_Implementation(const bool bNewDesired
 void AAlsCharacter::ServerSetDesiredAiming_Implementation(const bool bNewDesiredAiming) { SetDesiredAiming(bNewDesiredAiming, false); }
 void AAlsCharacter::OnReplicated_DesiredAiming(const bool bPreviousDesiredAiming) {	K2_OnDesiredAimingChanged(bPreviousDesiredAiming); }
 void AAlsCharacter::ClientSetViewMode_Implementation(const FGameplayTag& NewViewMode) {	SetViewMode(NewViewMode, false); }
-void AAlsCharacter::ServerSetViewMode_Implementation(const FGameplayTag& NewViewMode) {	SetViewMode(NewViewMode, false); }
\ No newline at end of file
+void AAlsCharacter::ServerSetViewMode_Implementation(const FGameplayTag& NewViewMode) {	SetViewMode(NewViewMode, false); }
+
+void AAlsCharacter::ClientSetDesiredState_Implementation(const FAlsDesiredStateChanges& Changes) { ApplyDesiredStateChanges(Changes); }
+void AAlsCharacter::ServerSetDesiredState_Implementation(const FAlsDesiredStateChanges& Changes) { ApplyDesiredStateChanges(Changes); }
\ No newline at end of file
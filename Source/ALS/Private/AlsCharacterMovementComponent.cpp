@@ -6,11 +6,133 @@
 #include "Curves/CurveVector.h"
 #include "Engine/World.h"
 #include "GameFramework/Controller.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsUtility.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterMovementComponent)
 
+namespace AlsCharacterMovementComponentConstants
+{
+	// Speed below which a character with no acceleration on a static floor is considered to be standing still.
+	constexpr auto IdleSpeedThresholdSquared{FMath::Square(1.0f)};
+
+	// Maximum distance the capsule can move from the location of the cached floor query for it to be reused.
+	constexpr auto FloorCacheToleranceSquared{FMath::Square(0.1f)};
+}
+
+// Server move processing statistics. Start a CSV capture on a dedicated server (for example, with the "csvprofile start"
+// console command or the -csvCaptureFrames command line argument) to get the timings, move bytes and correction counts.
+
+CSV_DEFINE_CATEGORY(Als, true);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Server Moves"), STAT_UAlsCharacterMovementComponent_ServerMoves, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Server Move Packets Bytes"), STAT_UAlsCharacterMovementComponent_ServerMovePacketsBytes, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Server Corrections"), STAT_UAlsCharacterMovementComponent_ServerCorrections, STATGROUP_Als)
+
+namespace AlsServerMoveStatistics
+{
+	// Adds the cycles spent in the scope to the given counter, if any.
+	class FScopedCycles
+	{
+	private:
+		uint64* Cycles;
+
+		uint64 StartCycles;
+
+	public:
+		explicit FScopedCycles(uint64* NewCycles)
+			: Cycles{NewCycles},
+			  StartCycles{NewCycles != nullptr ? FPlatformTime::Cycles64() : 0} {}
+
+		~FScopedCycles()
+		{
+			if (Cycles != nullptr)
+			{
+				*Cycles += FPlatformTime::Cycles64() - StartCycles;
+			}
+		}
+	};
+}
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Saved Moves Pool Hits"), STAT_FAlsNetworkPredictionData_SavedMovesPoolHits, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Saved Moves Pool Misses"), STAT_FAlsNetworkPredictionData_SavedMovesPoolMisses, STATGROUP_Als)
+
+namespace AlsCharacterNetworkMoveDataPacking
+{
+	// The rotation mode, stance, and max allowed gait are packed into a single small value if they all use the built-in tags.
+	// Otherwise, a special value is sent, followed by the full tags, so that project-specific tags are still supported.
+
+	constexpr auto PackedStateBitsCount{5};
+	constexpr uint8 CustomTagsPackedState{(1 << PackedStateBitsCount) - 1};
+
+	const FNativeGameplayTag* const RotationModes[]
+	{
+		&AlsRotationModeTags::VelocityDirection,
+		&AlsRotationModeTags::ViewDirection,
+		&AlsRotationModeTags::Aiming
+	};
+
+	const FNativeGameplayTag* const Stances[]
+	{
+		&AlsStanceTags::Standing,
+		&AlsStanceTags::Crouching
+	};
+
+	const FNativeGameplayTag* const Gaits[]
+	{
+		&AlsGaitTags::Walking,
+		&AlsGaitTags::Running,
+		&AlsGaitTags::Sprinting
+	};
+
+	constexpr auto PackedStatesCount{UE_ARRAY_COUNT(RotationModes) * UE_ARRAY_COUNT(Stances) * UE_ARRAY_COUNT(Gaits)};
+
+	static_assert(PackedStatesCount <= CustomTagsPackedState);
+
+	template <int32 TagsCount>
+	int32 FindTagIndex(const FGameplayTag& Tag, const FNativeGameplayTag* const (&Tags)[TagsCount])
+	{
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			if (Tag == *Tags[i])
+			{
+				return i;
+			}
+		}
+
+		return INDEX_NONE;
+	}
+
+	uint8 PackState(const FGameplayTag& RotationMode, const FGameplayTag& Stance, const FGameplayTag& MaxAllowedGait)
+	{
+		const auto RotationModeIndex{FindTagIndex(RotationMode, RotationModes)};
+		const auto StanceIndex{FindTagIndex(Stance, Stances)};
+		const auto GaitIndex{FindTagIndex(MaxAllowedGait, Gaits)};
+
+		if (RotationModeIndex < 0 || StanceIndex < 0 || GaitIndex < 0)
+		{
+			return CustomTagsPackedState;
+		}
+
+		return static_cast<uint8>((RotationModeIndex * UE_ARRAY_COUNT(Stances) + StanceIndex) * UE_ARRAY_COUNT(Gaits) + GaitIndex);
+	}
+
+	bool UnpackState(const uint8 PackedState, FGameplayTag& RotationMode, FGameplayTag& Stance, FGameplayTag& MaxAllowedGait)
+	{
+		if (PackedState >= PackedStatesCount)
+		{
+			return false;
+		}
+
+		RotationMode = *RotationModes[PackedState / (UE_ARRAY_COUNT(Stances) * UE_ARRAY_COUNT(Gaits))];
+		Stance = *Stances[PackedState / UE_ARRAY_COUNT(Gaits) % UE_ARRAY_COUNT(Stances)];
+		MaxAllowedGait = *Gaits[PackedState % UE_ARRAY_COUNT(Gaits)];
+
+		return true;
+	}
+}
+
 void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& Move, const ENetworkMoveType MoveType)
 {
 	Super::ClientFillNetworkMoveData(Move, MoveType);
@@ -27,11 +149,39 @@ bool FAlsCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Moveme
 {
 	Super::Serialize(Movement, Archive, Map, MoveType);
 
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, RotationMode, AlsRotationModeTags::ViewDirection.GetTag(), Map);
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, Stance, AlsStanceTags::Standing.GetTag(), Map);
-	NetSerializeOptionalValue(Archive.IsSaving(), Archive, MaxAllowedGait, AlsGaitTags::Walking.GetTag(), Map);
+	uint8 PackedState{0};
+
+	if (Archive.IsSaving())
+	{
+		PackedState = AlsCharacterNetworkMoveDataPacking::PackState(RotationMode, Stance, MaxAllowedGait);
+	}
+
+	Archive.SerializeBits(&PackedState, AlsCharacterNetworkMoveDataPacking::PackedStateBitsCount);
+
+	auto bSuccess{true};
+
+	if (PackedState == AlsCharacterNetworkMoveDataPacking::CustomTagsPackedState)
+	{
+		// FGameplayTag::NetSerialize() overwrites its success flag, so each result is combined separately.
+
+		auto bTagSuccess{true};
 
-	return !Archive.IsError();
+		RotationMode.NetSerialize(Archive, Map, bTagSuccess);
+		bSuccess &= bTagSuccess;
+
+		Stance.NetSerialize(Archive, Map, bTagSuccess);
+		bSuccess &= bTagSuccess;
+
+		MaxAllowedGait.NetSerialize(Archive, Map, bTagSuccess);
+		bSuccess &= bTagSuccess;
+	}
+	else if (Archive.IsLoading() &&
+	         !AlsCharacterNetworkMoveDataPacking::UnpackState(PackedState, RotationMode, Stance, MaxAllowedGait))
+	{
+		Archive.SetError();
+	}
+
+	return bSuccess && !Archive.IsError();
 }
 
 FAlsCharacterNetworkMoveDataContainer::FAlsCharacterNetworkMoveDataContainer()
@@ -102,21 +252,48 @@ void FAlsSavedMove::PrepMoveFor(ACharacter* Character)
 	auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
 	if (IsValid(Movement))
 	{
-		Movement->RotationMode = RotationMode;
-		Movement->Stance = Stance;
-		Movement->MaxAllowedGait = MaxAllowedGait;
-
-		Movement->RefreshGaitSettings();
+		Movement->ApplyNetworkMoveState(RotationMode, Stance, MaxAllowedGait);
 	}
 }
 
-FAlsNetworkPredictionData::FAlsNetworkPredictionData(const UCharacterMovementComponent& Movement) : Super{Movement} {}
+FAlsNetworkPredictionData::FAlsNetworkPredictionData(const UCharacterMovementComponent& Movement) : Super{Movement}
+{
+	// Saved moves are recycled through the free moves list, so allocate them all at once here instead of one by one while playing.
+
+	const auto MovesCount{FMath::Min(PreallocatedMovesCount, MaxFreeMoveCount)};
+
+	for (auto i{0}; i < MovesCount; i++)
+	{
+		FreeMoves.Emplace(AllocateNewMove());
+	}
+}
 
 FSavedMovePtr FAlsNetworkPredictionData::AllocateNewMove()
 {
 	return MakeShared<FAlsSavedMove>();
 }
 
+FSavedMovePtr FAlsNetworkPredictionData::CreateSavedMove()
+{
+	// Super::CreateSavedMove() takes a move from the free moves list, or allocates a new one if the list is empty.
+
+	if (SavedMoves.Num() < MaxSavedMoveCount)
+	{
+		if (FreeMoves.IsEmpty())
+		{
+			SavedMovesPoolMisses += 1;
+			INC_DWORD_STAT(STAT_FAlsNetworkPredictionData_SavedMovesPoolMisses)
+		}
+		else
+		{
+			SavedMovesPoolHits += 1;
+			INC_DWORD_STAT(STAT_FAlsNetworkPredictionData_SavedMovesPoolHits)
+		}
+	}
+
+	return Super::CreateSavedMove();
+}
+
 UAlsCharacterMovementComponent::UAlsCharacterMovementComponent()
 {
 	SetNetworkMoveDataContainer(MoveDataContainer);
@@ -185,6 +362,8 @@ void UAlsCharacterMovementComponent::BeginPlay()
 	                   TEXT("These settings are not allowed and must be turned off!"));
 
 	Super::BeginPlay();
+
+	RefreshDerivedState();
 }
 
 void UAlsCharacterMovementComponent::SetMovementMode(const EMovementMode NewMovementMode, const uint8 NewCustomMode)
@@ -231,6 +410,13 @@ void UAlsCharacterMovementComponent::UpdateBasedRotation(FRotator& FinalRotation
 	}
 }
 
+void UAlsCharacterMovementComponent::OnTeleported()
+{
+	InvalidateFloorCache();
+
+	Super::OnTeleported();
+}
+
 void UAlsCharacterMovementComponent::CalcVelocity(const float DeltaTime, const float Friction,
                                                   const bool bFluid, const float BrakingDeceleration)
 {
@@ -249,7 +435,7 @@ float UAlsCharacterMovementComponent::GetMaxAcceleration() const
 	// Get the acceleration using the movement curve. This allows for fine control over movement behavior at each speed.
 
 	return IsMovingOnGround() && ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
-		       ? GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].Eval(CalculateGaitAmount())
+		       ? GetAccelerationAndDecelerationAndGroundFriction()[0]
 		       : Super::GetMaxAcceleration();
 }
 
@@ -258,7 +444,7 @@ float UAlsCharacterMovementComponent::GetMaxBrakingDeceleration() const
 	// Get the deceleration using the movement curve. This allows for fine control over movement behavior at each speed.
 
 	return IsMovingOnGround() && ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve))
-		       ? GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[1].Eval(CalculateGaitAmount())
+		       ? GetAccelerationAndDecelerationAndGroundFriction()[1]
 		       : Super::GetMaxBrakingDeceleration();
 }
 
@@ -285,11 +471,19 @@ void UAlsCharacterMovementComponent::PhysicsRotation(const float DeltaTime)
 
 void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 Iterations)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::PhysWalking()"),
+	                            STAT_UAlsCharacterMovementComponent_PhysWalking, STATGROUP_Als)
+	CSV_SCOPED_TIMING_STAT(Als, PhysWalking);
+
+	const AlsServerMoveStatistics::FScopedCycles ServerMoveStatisticsCycles{
+		bServerMoveStatisticsEnabled ? &ServerMoveStatistics.PhysWalkingCycles : nullptr
+	};
+
 	if (ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve)))
 	{
 		// Get the ground friction using the movement curve. This allows for fine control over movement behavior at each speed.
 
-		GroundFriction = GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(CalculateGaitAmount());
+		GroundFriction = GetAccelerationAndDecelerationAndGroundFriction()[2];
 	}
 
 	// TODO Copied with modifications from UCharacterMovementComponent::PhysWalking().
@@ -317,6 +511,21 @@ void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 It
 		return;
 	}
 
+	// TODO Start of custom ALS code block.
+
+	if (CanSkipWalkingSimulation())
+	{
+		// The character is standing still on a static floor, so the move loop below would not move it anyway,
+		// and the current floor is still valid, so skip the floor and ledge checks and just stop the character.
+
+		bJustTeleported = false;
+		Acceleration = FVector::ZeroVector;
+		Velocity = FVector::ZeroVector;
+		return;
+	}
+
+	// TODO End of custom ALS code block.
+
 	// devCode(ensureMsgf(!Velocity.ContainsNaN(), TEXT("PhysWalking: Velocity contains NaN before Iteration (%s)\n%s"), *GetPathNameSafe(this), *Velocity.ToString()));
 
 	bJustTeleported = false;
@@ -539,16 +748,45 @@ void UAlsCharacterMovementComponent::PhysWalking(const float DeltaTime, int32 It
 		MaintainHorizontalGroundVelocity();
 	}
 
+	// TODO Start of custom ALS code block.
+
+	PreviousWalkingLocation = UpdatedComponent->GetComponentLocation();
+
+	// TODO End of custom ALS code block.
+
 	// ReSharper restore All
 }
 
+bool UAlsCharacterMovementComponent::CanSkipWalkingSimulation() const
+{
+	if (bJustTeleported || bForceNextFloorCheck || bHasRequestedVelocity || !PendingPenetrationAdjustment.IsNearlyZero() ||
+	    HasAnimRootMotion() || CurrentRootMotion.HasActiveRootMotionSources() ||
+	    !Acceleration.IsNearlyZero() || Velocity.SizeSquared() > AlsCharacterMovementComponentConstants::IdleSpeedThresholdSquared)
+	{
+		return false;
+	}
+
+	if (!CurrentFloor.IsWalkableFloor() || CurrentFloor.HitResult.bStartPenetrating ||
+	    UpdatedComponent->GetComponentLocation() != PreviousWalkingLocation)
+	{
+		return false;
+	}
+
+	// The floor must still be the movement base, and must not be able to move or lose its collision.
+
+	const auto* MovementBase{GetMovementBase()};
+
+	return IsValid(MovementBase) && MovementBase == CurrentFloor.HitResult.Component.Get() &&
+	       !MovementBaseUtility::IsDynamicBase(MovementBase) && MovementBase->IsQueryCollisionEnabled();
+}
+
 void UAlsCharacterMovementComponent::PhysNavWalking(const float DeltaTime, const int32 Iterations)
 {
 	if (ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve)))
 	{
 		// Get the ground friction using the movement curve. This allows for fine control over movement behavior at each speed.
 
-		GroundFriction = GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(CalculateGaitAmount());
+		GroundFriction = GetAccelerationAndDecelerationAndGroundFriction()[2];
 	}
 
 	Super::PhysNavWalking(DeltaTime, Iterations);
@@ -593,9 +831,119 @@ FVector UAlsCharacterMovementComponent::ConsumeInputVector()
 	return InputVector;
 }
 
-void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance,
-                                                      FFindFloorResult& OutFloorResult, float SweepRadius,
+void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, const float LineDistance, const float SweepDistance,
+                                                      FFindFloorResult& OutFloorResult, const float SweepRadius,
                                                       const FHitResult* DownwardSweepResult) const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::ComputeFloorDist()"),
+	                            STAT_UAlsCharacterMovementComponent_ComputeFloorDist, STATGROUP_Als)
+	CSV_SCOPED_TIMING_STAT(Als, ComputeFloorDist);
+
+	const AlsServerMoveStatistics::FScopedCycles ServerMoveStatisticsCycles{
+		bServerMoveStatisticsEnabled ? &ServerMoveStatistics.ComputeFloorDistCycles : nullptr
+	};
+
+	// A supplied downward sweep result already avoids the floor query, so the cache is only used without it.
+
+	if (DownwardSweepResult != nullptr)
+	{
+		ComputeFloorDistUncached(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+		return;
+	}
+
+	if (TryGetCachedFloor(CapsuleLocation, LineDistance, SweepDistance, SweepRadius, OutFloorResult))
+	{
+		return;
+	}
+
+	ComputeFloorDistUncached(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, nullptr);
+
+	CacheFloor(CapsuleLocation, LineDistance, SweepDistance, SweepRadius, OutFloorResult);
+}
+
+void UAlsCharacterMovementComponent::InvalidateFloorCache()
+{
+	FloorCache.bValid = false;
+}
+
+bool UAlsCharacterMovementComponent::TryGetCachedFloor(const FVector& CapsuleLocation, const float LineDistance, const float SweepDistance,
+                                                       const float SweepRadius, FFindFloorResult& OutFloorResult) const
+{
+	if (!FloorCache.bValid || bJustTeleported || bForceNextFloorCheck ||
+	    FloorCache.LineDistance != LineDistance || FloorCache.SweepDistance != SweepDistance ||
+	    FloorCache.SweepRadius != SweepRadius || FloorCache.WalkableFloorZ != GetWalkableFloorZ() ||
+	    FVector::DistSquared(FloorCache.CapsuleLocation, CapsuleLocation) > AlsCharacterMovementComponentConstants::FloorCacheToleranceSquared ||
+	    !FloorCache.CapsuleRotation.Equals(UpdatedComponent->GetComponentQuat(), UE_SMALL_NUMBER) ||
+	    FloorCache.MovementBase.Get() != GetMovementBase())
+	{
+		return false;
+	}
+
+	float CapsuleRadius, CapsuleHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+
+	if (FloorCache.CapsuleRadius != CapsuleRadius || FloorCache.CapsuleHalfHeight != CapsuleHalfHeight)
+	{
+		return false;
+	}
+
+	// The floor must still exist, must not be able to move, and must still block the character.
+
+	const auto* Floor{FloorCache.FloorResult.HitResult.GetComponent()};
+
+	if (!IsValid(Floor) || MovementBaseUtility::IsDynamicBase(Floor) || !Floor->IsQueryCollisionEnabled() ||
+	    Floor->GetCollisionResponseToChannel(UpdatedComponent->GetCollisionObjectType()) != ECR_Block)
+	{
+		FloorCache.bValid = false;
+		return false;
+	}
+
+	OutFloorResult = FloorCache.FloorResult;
+
+	// Account for the small vertical offset between the cached and the current capsule location.
+
+	const auto VerticalOffset{UE_REAL_TO_FLOAT(RotateWorldToGravity(CapsuleLocation - FloorCache.CapsuleLocation).Z)};
+
+	OutFloorResult.FloorDist += VerticalOffset;
+
+	if (OutFloorResult.bLineTrace)
+	{
+		OutFloorResult.LineDist += VerticalOffset;
+	}
+
+	return true;
+}
+
+void UAlsCharacterMovementComponent::CacheFloor(const FVector& CapsuleLocation, const float LineDistance, const float SweepDistance,
+                                                const float SweepRadius, const FFindFloorResult& FloorResult) const
+{
+	// Only walkable floors on static objects are cached, since anything else can change without the character moving.
+
+	const auto* Floor{FloorResult.HitResult.GetComponent()};
+
+	FloorCache.bValid = FloorResult.IsWalkableFloor() && !FloorResult.HitResult.bStartPenetrating &&
+	                    IsValid(Floor) && !MovementBaseUtility::IsDynamicBase(Floor);
+
+	if (!FloorCache.bValid)
+	{
+		return;
+	}
+
+	FloorCache.FloorResult = FloorResult;
+	FloorCache.CapsuleLocation = CapsuleLocation;
+	FloorCache.CapsuleRotation = UpdatedComponent->GetComponentQuat();
+	FloorCache.MovementBase = GetMovementBase();
+	FloorCache.LineDistance = LineDistance;
+	FloorCache.SweepDistance = SweepDistance;
+	FloorCache.SweepRadius = SweepRadius;
+	FloorCache.WalkableFloorZ = GetWalkableFloorZ();
+
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(FloorCache.CapsuleRadius, FloorCache.CapsuleHalfHeight);
+}
+
+void UAlsCharacterMovementComponent::ComputeFloorDistUncached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance,
+                                                              FFindFloorResult& OutFloorResult, float SweepRadius,
+                                                              const FHitResult* DownwardSweepResult) const
 {
 	// TODO Copied with modifications from UCharacterMovementComponent::ComputeFloorDist().
 	// TODO After the release of a new engine version, this code should be updated to match the source code.
@@ -755,6 +1103,8 @@ void UAlsCharacterMovementComponent::PerformMovement(const float DeltaTime)
 {
 	Super::PerformMovement(DeltaTime);
 
+	RefreshDerivedState();
+
 	// Update the ServerLastTransformUpdateTimeStamp when the control rotation
 	// changes. This is required for the view network smoothing to work properly.
 
@@ -774,6 +1124,15 @@ void UAlsCharacterMovementComponent::PerformMovement(const float DeltaTime)
 	}
 }
 
+void UAlsCharacterMovementComponent::SimulatedTick(const float DeltaTime)
+{
+	// Simulated proxies are moved either by SimulateMovement() or by SimulateRootMotion(), both called from here.
+
+	Super::SimulatedTick(DeltaTime);
+
+	RefreshDerivedState();
+}
+
 FNetworkPredictionData_Client* UAlsCharacterMovementComponent::GetPredictionData_Client() const
 {
 	if (ClientPredictionData == nullptr)
@@ -810,14 +1169,25 @@ void UAlsCharacterMovementComponent::SmoothClientPosition(const float DeltaTime)
 void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp, const float DeltaTime,
                                                     const uint8 CompressedFlags, const FVector& NewAcceleration)
 {
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::MoveAutonomous()"),
+	                            STAT_UAlsCharacterMovementComponent_MoveAutonomous, STATGROUP_Als)
+	CSV_SCOPED_TIMING_STAT(Als, MoveAutonomous);
+	CSV_CUSTOM_STAT(Als, ServerMoves, 1, ECsvCustomStatOp::Accumulate);
+	INC_DWORD_STAT(STAT_UAlsCharacterMovementComponent_ServerMoves)
+
+	const AlsServerMoveStatistics::FScopedCycles ServerMoveStatisticsCycles{
+		bServerMoveStatisticsEnabled ? &ServerMoveStatistics.MoveAutonomousCycles : nullptr
+	};
+
+	if (bServerMoveStatisticsEnabled)
+	{
+		ServerMoveStatistics.MovesCount += 1;
+	}
+
 	const auto* MoveData{static_cast<FAlsCharacterNetworkMoveData*>(GetCurrentNetworkMoveData())};
 	if (MoveData != nullptr)
 	{
-		RotationMode = MoveData->RotationMode;
-		Stance = MoveData->Stance;
-		MaxAllowedGait = MoveData->MaxAllowedGait;
-
-		RefreshGaitSettings();
+		ApplyNetworkMoveState(MoveData->RotationMode, MoveData->Stance, MoveData->MaxAllowedGait);
 	}
 
 	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAcceleration);
@@ -840,6 +1210,48 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 	}
 }
 
+void UAlsCharacterMovementComponent::ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits)
+{
+	// A packet contains up to three moves, so divide the total bytes by the number of server moves to get the bytes per move.
+
+	const auto PacketBytes{(PackedBits.DataBits.Num() + 7) / 8};
+
+	CSV_CUSTOM_STAT(Als, ServerMovePacketsBytes, PacketBytes, ECsvCustomStatOp::Accumulate);
+	INC_DWORD_STAT_BY(STAT_UAlsCharacterMovementComponent_ServerMovePacketsBytes, PacketBytes)
+
+	if (bServerMoveStatisticsEnabled)
+	{
+		ServerMoveStatistics.MovePacketsCount += 1;
+		ServerMoveStatistics.MovePacketsBytes += PacketBytes;
+	}
+
+	Super::ServerMovePacked_ServerReceive(PackedBits);
+}
+
+bool UAlsCharacterMovementComponent::ServerCheckClientError(const float ClientTimeStamp, const float DeltaTime, const FVector& Accel,
+                                                            const FVector& ClientWorldLocation, const FVector& RelativeClientLocation,
+                                                            UPrimitiveComponent* ClientMovementBase, const FName ClientBaseBoneName,
+                                                            const uint8 ClientMovementMode)
+{
+	const auto bError{
+		Super::ServerCheckClientError(ClientTimeStamp, DeltaTime, Accel, ClientWorldLocation, RelativeClientLocation,
+		                              ClientMovementBase, ClientBaseBoneName, ClientMovementMode)
+	};
+
+	if (bError)
+	{
+		CSV_CUSTOM_STAT(Als, ServerCorrections, 1, ECsvCustomStatOp::Accumulate);
+		INC_DWORD_STAT(STAT_UAlsCharacterMovementComponent_ServerCorrections)
+
+		if (bServerMoveStatisticsEnabled)
+		{
+			ServerMoveStatistics.CorrectionsCount += 1;
+		}
+	}
+
+	return bError;
+}
+
 void UAlsCharacterMovementComponent::SavePenetrationAdjustment(const FHitResult& Hit)
 {
 	if (Hit.bStartPenetrating)
@@ -880,9 +1292,32 @@ void UAlsCharacterMovementComponent::RefreshGaitSettings()
 		GaitSettings = ALS_ENSURE(NewGaitSettings != nullptr) ? *NewGaitSettings : FAlsMovementGaitSettings{};
 	}
 
+	bAccelerationAndDecelerationAndGroundFrictionValid = false;
+
 	RefreshMaxWalkSpeed();
 }
 
+void UAlsCharacterMovementComponent::ApplyNetworkMoveState(const FGameplayTag& NewRotationMode, const FGameplayTag& NewStance,
+                                                           const FGameplayTag& NewMaxAllowedGait)
+{
+	// This is called for every move processed on the server and for every move replayed on the client,
+	// but the rotation mode and stance rarely change between moves, so refresh the gait settings only when needed.
+
+	MaxAllowedGait = NewMaxAllowedGait;
+
+	if (RotationMode != NewRotationMode || Stance != NewStance)
+	{
+		RotationMode = NewRotationMode;
+		Stance = NewStance;
+
+		RefreshGaitSettings();
+	}
+	else
+	{
+		RefreshMaxWalkSpeed();
+	}
+}
+
 void UAlsCharacterMovementComponent::SetRotationMode(const FGameplayTag& NewRotationMode)
 {
 	if (RotationMode != NewRotationMode)
@@ -919,6 +1354,35 @@ void UAlsCharacterMovementComponent::RefreshMaxWalkSpeed()
 	MaxWalkSpeedCrouched = MaxWalkSpeed;
 }
 
+const FVector3f& UAlsCharacterMovementComponent::GetAccelerationAndDecelerationAndGroundFriction() const
+{
+	const FVector2D Velocity2D{Velocity};
+
+	if (!bAccelerationAndDecelerationAndGroundFrictionValid ||
+	    AccelerationAndDecelerationAndGroundFrictionVelocity != Velocity2D)
+	{
+		AccelerationAndDecelerationAndGroundFriction = GaitSettings.SampleAccelerationAndDecelerationAndGroundFriction(CalculateGaitAmount());
+		AccelerationAndDecelerationAndGroundFrictionVelocity = Velocity2D;
+		bAccelerationAndDecelerationAndGroundFrictionValid = true;
+	}
+
+	return AccelerationAndDecelerationAndGroundFriction;
+}
+
+void UAlsCharacterMovementComponent::RefreshDerivedState()
+{
+	if (!HasValidData())
+	{
+		return;
+	}
+
+	DerivedState.MaxAcceleration = GetMaxAcceleration();
+	DerivedState.MaxBrakingDeceleration = GetMaxBrakingDeceleration();
+	DerivedState.WalkableFloorZ = GetWalkableFloorZ();
+
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(DerivedState.CapsuleRadius, DerivedState.CapsuleHalfHeight);
+}
+
 float UAlsCharacterMovementComponent::CalculateGaitAmount() const
 {
 	// Map the character's current speed to the configured movement speeds ranging from 0 to 3,
@@ -966,3 +1430,13 @@ bool UAlsCharacterMovementComponent::TryConsumePrePenetrationAdjustmentVelocity(
 
 	return true;
 }
+
+void UAlsCharacterMovementComponent::SetServerMoveStatisticsEnabled(const bool bNewServerMoveStatisticsEnabled)
+{
+	bServerMoveStatisticsEnabled = bNewServerMoveStatisticsEnabled;
+
+	if (bServerMoveStatisticsEnabled)
+	{
+		ServerMoveStatistics = {};
+	}
+}
@@ -2,7 +2,6 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
-#include "DrawDebugHelpers.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/NetConnection.h"
@@ -10,6 +9,7 @@
 #include "RootMotionSources/AlsRootMotionSource_Mantling.h"
 #include "Settings/AlsCharacterSettings.h"
 #include "Utility/AlsConstants.h"
+#include "Utility/AlsDebugDrawSubsystem.h"
 #include "Utility/AlsLog.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsUtility.h"
@@ -185,7 +185,11 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	};
 
 #if ENABLE_DRAW_DEBUG
-	const auto bDisplayDebug{UAlsUtility::ShouldDisplayDebugForActor(this, UAlsConstants::MantlingDebugDisplayName())};
+	auto* DebugDrawSubsystem{
+		UAlsUtility::ShouldDisplayDebugForActor(this, UAlsConstants::MantlingDebugDisplayName())
+			? GetWorld()->GetSubsystem<UAlsDebugDrawSubsystem>()
+			: nullptr
+	};
 #endif
 
 	const auto* Capsule{GetCapsuleComponent()};
@@ -227,11 +231,11 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	    GetCharacterMovement()->IsWalkable(ForwardTraceHit))
 	{
 #if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
+		if (IsValid(DebugDrawSubsystem))
 		{
-			UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, false, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			DebugDrawSubsystem->QueueSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+			                                                       ForwardTraceCapsuleHalfHeight, false, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
+			                                                       {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
 		}
 #endif
 
@@ -280,15 +284,15 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	    !GetCharacterMovement()->IsWalkable(DownwardTraceHit))
 	{
 #if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
+		if (IsValid(DebugDrawSubsystem))
 		{
-			UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			DebugDrawSubsystem->QueueSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+			                                                       ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
+			                                                       {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
 
-			UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+			DebugDrawSubsystem->QueueSweepSingleSphere(DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
+			                                           false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
+			                                           TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
 		}
 #endif
 
@@ -312,18 +316,18 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	                                             {TargetLocationTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses))
 	{
 #if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
+		if (IsValid(DebugDrawSubsystem))
 		{
-			UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			DebugDrawSubsystem->QueueSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+			                                                       ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit, {0.0f, 0.25f, 1.0f},
+			                                                       {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
 
-			UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+			DebugDrawSubsystem->QueueSweepSingleSphere(DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
+			                                           false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
+			                                           TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
 
-			DrawDebugCapsule(GetWorld(), TargetCapsuleLocation, CapsuleHalfHeight, CapsuleRadius, FQuat::Identity,
-			                 FColor::Red, false, TraceSettings.bDrawFailedTraces ? 10.0f : 0.0f);
+			DebugDrawSubsystem->QueueCapsule(TargetCapsuleLocation, FQuat::Identity, CapsuleRadius, CapsuleHalfHeight,
+			                                 FLinearColor::Red, TraceSettings.bDrawFailedTraces ? 10.0f : 0.0f);
 		}
 #endif
 
@@ -350,19 +354,19 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	                                             {StartLocationTraceTag, false, this}, Settings->Mantling.MantlingTraceResponses))
 	{
 #if ENABLE_DRAW_DEBUG
-		if (bDisplayDebug)
+		if (IsValid(DebugDrawSubsystem))
 		{
-			UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-			                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
-			                                                    {0.0f, 0.25f, 1.0f},
-			                                                    {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
+			DebugDrawSubsystem->QueueSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+			                                                       ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
+			                                                       {0.0f, 0.25f, 1.0f},
+			                                                       {0.0f, 0.75f, 1.0f}, TraceSettings.bDrawFailedTraces ? 5.0f : 0.0f);
 
-			UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
-			                                        false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
-			                                        TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
+			DebugDrawSubsystem->QueueSweepSingleSphere(DownwardTraceStart, DownwardTraceEnd, TraceCapsuleRadius,
+			                                           false, DownwardTraceHit, {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f},
+			                                           TraceSettings.bDrawFailedTraces ? 7.5f : 0.0f);
 
-			DrawDebugCapsule(GetWorld(), StartLocation, StartLocationTraceCapsuleHalfHeight, TraceCapsuleRadius, FQuat::Identity,
-			                 FLinearColor{1.0f, 0.5f, 0.0f}.ToFColor(true), false, TraceSettings.bDrawFailedTraces ? 10.0f : 0.0f);
+			DebugDrawSubsystem->QueueCapsule(StartLocation, FQuat::Identity, TraceCapsuleRadius, StartLocationTraceCapsuleHalfHeight,
+			                                 {1.0f, 0.5f, 0.0f}, TraceSettings.bDrawFailedTraces ? 10.0f : 0.0f);
 		}
 #endif
 
@@ -370,15 +374,15 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 	}
 
 #if ENABLE_DRAW_DEBUG
-	if (bDisplayDebug)
+	if (IsValid(DebugDrawSubsystem))
 	{
-		UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
-		                                                    ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
-		                                                    {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f}, 5.0f);
+		DebugDrawSubsystem->QueueSweepSingleCapsuleAlternative(ForwardTraceStart, ForwardTraceEnd, TraceCapsuleRadius,
+		                                                       ForwardTraceCapsuleHalfHeight, true, ForwardTraceHit,
+		                                                       {0.0f, 0.25f, 1.0f}, {0.0f, 0.75f, 1.0f}, 5.0f);
 
-		UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), DownwardTraceStart, DownwardTraceEnd,
-		                                        TraceCapsuleRadius, true, DownwardTraceHit,
-		                                        {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 7.5f);
+		DebugDrawSubsystem->QueueSweepSingleSphere(DownwardTraceStart, DownwardTraceEnd,
+		                                           TraceCapsuleRadius, true, DownwardTraceHit,
+		                                           {0.25f, 0.0f, 1.0f}, {0.75f, 0.0f, 1.0f}, 7.5f);
 	}
 #endif
 
@@ -4,6 +4,7 @@
 #include "AlsAnimationInstanceProxy.h"
 #include "AlsCharacter.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsLinkedAnimationInstance)
 
@@ -47,11 +48,44 @@ void UAlsLinkedAnimationInstance::NativeBeginPlay()
 	Super::NativeBeginPlay();
 }
 
+void UAlsLinkedAnimationInstance::NativeThreadSafeUpdateAnimation(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsLinkedAnimationInstance::NativeThreadSafeUpdateAnimation()"),
+	                            STAT_UAlsLinkedAnimationInstance_NativeThreadSafeUpdateAnimation, STATGROUP_Als)
+
+	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
+
+	if (!Parent.IsValid() || Parent->HasAnyFlags(RF_ClassDefaultObject))
+	{
+		// The default parent object used for editor preview is never updated, so it is considered always updated.
+
+		bParentUpdated = true;
+		NativeThreadSafeUpdateLayer(DeltaTime);
+		return;
+	}
+
+	bParentUpdated = ParentUpdateRevision != Parent->UpdateRevision;
+	ParentUpdateRevision = Parent->UpdateRevision;
+
+	if (bParentUpdated || !bSkipUpdateIfParentNotUpdated)
+	{
+		NativeThreadSafeUpdateLayer(DeltaTime);
+	}
+}
+
 FAnimInstanceProxy* UAlsLinkedAnimationInstance::CreateAnimInstanceProxy()
 {
 	return new FAlsAnimationInstanceProxy{this};
 }
 
+void UAlsLinkedAnimationInstance::NativeThreadSafeUpdateLayer(const float DeltaTime) {}
+
+const UAlsAnimationInstance& UAlsLinkedAnimationInstance::GetParentChecked() const
+{
+	const auto* ParentInstance{Parent.Get()};
+	return ALS_ENSURE(IsValid(ParentInstance)) ? *ParentInstance : *GetDefault<UAlsAnimationInstance>();
+}
+
 void UAlsLinkedAnimationInstance::ReinitializeLook()
 {
 	if (Parent.IsValid())
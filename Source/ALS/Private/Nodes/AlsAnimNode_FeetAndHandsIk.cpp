@@ -0,0 +1,296 @@
+#include "Nodes/AlsAnimNode_FeetAndHandsIk.h"
+
+#include "TwoBoneIK.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "Animation/AnimTrace.h"
+#include "Utility/AlsMath.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNode_FeetAndHandsIk)
+
+namespace AlsFeetAndHandsIkNode
+{
+	struct FLegTransforms
+	{
+		FTransform Thigh;
+		FTransform Calf;
+		FTransform Foot;
+	};
+
+	static FLegTransforms GetLegTransforms(FCSPose<FCompactPose>& Pose, const FCompactPoseBoneIndex ThighIndex,
+	                                       const FCompactPoseBoneIndex CalfIndex, const FCompactPoseBoneIndex FootIndex)
+	{
+		return {
+			Pose.GetComponentSpaceTransform(ThighIndex),
+			Pose.GetComponentSpaceTransform(CalfIndex),
+			Pose.GetComponentSpaceTransform(FootIndex)
+		};
+	}
+
+	// Returns how much the thigh must be lowered for the foot to reach its IK location. Zero if the location is already reachable.
+	static float CalculateRequiredPelvisOffsetZ(const FLegTransforms& Leg, const FVector& IkLocation, const float IkAmount)
+	{
+		if (!FAnimWeight::IsRelevant(IkAmount))
+		{
+			return 0.0f;
+		}
+
+		const auto LegLength{
+			FVector::Distance(Leg.Thigh.GetLocation(), Leg.Calf.GetLocation()) +
+			FVector::Distance(Leg.Calf.GetLocation(), Leg.Foot.GetLocation())
+		};
+
+		const auto ThighToTarget{FMath::Lerp(Leg.Foot.GetLocation(), IkLocation, IkAmount) - Leg.Thigh.GetLocation()};
+		const auto HorizontalDistanceSquared{ThighToTarget.SizeSquared2D()};
+
+		if (HorizontalDistanceSquared >= FMath::Square(LegLength))
+		{
+			return FMath::Min(0.0f, UE_REAL_TO_FLOAT(ThighToTarget.Z));
+		}
+
+		const auto MaxVerticalDistance{FMath::Sqrt(FMath::Square(LegLength) - HorizontalDistanceSquared)};
+
+		return FMath::Min(0.0f, UE_REAL_TO_FLOAT(ThighToTarget.Z + MaxVerticalDistance));
+	}
+
+	static void SolveLeg(FLegTransforms& Leg, const FVector& IkLocation, const FQuat& IkRotation, const float IkAmount)
+	{
+		if (!FAnimWeight::IsRelevant(IkAmount))
+		{
+			return;
+		}
+
+		// Use the current knee direction as the pole vector, same as the control rig does.
+
+		FVector KneeProjectionLocation;
+		FVector KneeDirection;
+
+		const auto JointTarget{
+			UAlsMath::TryCalculatePoleVector(Leg.Thigh.GetLocation(), Leg.Calf.GetLocation(), Leg.Foot.GetLocation(),
+			                                 KneeProjectionLocation, KneeDirection)
+				? Leg.Calf.GetLocation() + KneeDirection * FVector::Distance(Leg.Thigh.GetLocation(), Leg.Calf.GetLocation())
+				: Leg.Calf.GetLocation()
+		};
+
+		const auto FootRotation{FQuat::Slerp(Leg.Foot.GetRotation(), IkRotation, IkAmount).GetNormalized()};
+
+		AnimationCore::SolveTwoBoneIK(Leg.Thigh, Leg.Calf, Leg.Foot, JointTarget,
+		                              FMath::Lerp(Leg.Foot.GetLocation(), IkLocation, IkAmount), false, 1.0, 1.0);
+
+		Leg.Foot.SetRotation(FootRotation);
+	}
+}
+
+void FAlsAnimNode_FeetAndHandsIk::GatherDebugData(FNodeDebugData& DebugData)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(GatherDebugData)
+
+	TStringBuilder<256> DebugItemBuilder;
+
+	DebugItemBuilder << DebugData.GetNodeName(this) << TEXTVIEW(": Alpha: ");
+	DebugItemBuilder.Appendf(TEXT("%.2f"), ActualAlpha);
+
+	DebugData.AddDebugItem(FString{DebugItemBuilder});
+	ComponentPose.GatherDebugData(DebugData);
+}
+
+void FAlsAnimNode_FeetAndHandsIk::EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output,
+                                                                    TArray<FBoneTransform>& OutBoneTransforms)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+	ANIM_MT_SCOPE_CYCLE_COUNTER_VERBOSE(FeetAndHandsIk, !IsInGameThread());
+
+	auto PelvisOffsetZ{0.0f};
+
+	EvaluateFeetIk(Output.Pose, OutBoneTransforms, PelvisOffsetZ);
+
+	if (RigInput.bUseHandIkBones)
+	{
+		EvaluateHandsIkRetargeting(Output.Pose, PelvisOffsetZ, OutBoneTransforms);
+	}
+
+	OutBoneTransforms.Sort(FCompareBoneTransformIndex{});
+
+	TRACE_ANIM_NODE_VALUE(Output, TEXT("Pelvis Offset Z"), PelvisOffsetZ);
+}
+
+void FAlsAnimNode_FeetAndHandsIk::EvaluateFeetIk(FCSPose<FCompactPose>& Pose, TArray<FBoneTransform>& OutBoneTransforms,
+                                                 float& PelvisOffsetZ) const
+{
+	const auto& RequiredBones{Pose.GetPose().GetBoneContainer()};
+
+	const auto PelvisIndex{PelvisBone.GetCompactPoseIndex(RequiredBones)};
+	const auto FootLeftIndex{FootLeftBone.GetCompactPoseIndex(RequiredBones)};
+	const auto FootRightIndex{FootRightBone.GetCompactPoseIndex(RequiredBones)};
+
+	auto LeftLeg{AlsFeetAndHandsIkNode::GetLegTransforms(Pose, ThighLeftIndex, CalfLeftIndex, FootLeftIndex)};
+	auto RightLeg{AlsFeetAndHandsIkNode::GetLegTransforms(Pose, ThighRightIndex, CalfRightIndex, FootRightIndex)};
+
+	// Lower the pelvis just enough for both feet to reach their IK locations, but
+	// not lower than the lowest foot offset calculated by the animation instance.
+
+	PelvisOffsetZ = FMath::Max(
+		FMath::Min(AlsFeetAndHandsIkNode::CalculateRequiredPelvisOffsetZ(LeftLeg, RigInput.FootLeftIkLocation, RigInput.FootLeftIkAmount),
+		           AlsFeetAndHandsIkNode::CalculateRequiredPelvisOffsetZ(RightLeg, RigInput.FootRightIkLocation, RigInput.FootRightIkAmount)),
+		FMath::Min(0.0f, RigInput.MinMaxPelvisOffsetZ.X));
+
+	if (!FMath::IsNearlyZero(PelvisOffsetZ))
+	{
+		const FVector PelvisOffset{0.0f, 0.0f, PelvisOffsetZ};
+
+		auto PelvisTransform{Pose.GetComponentSpaceTransform(PelvisIndex)};
+		PelvisTransform.AddToTranslation(PelvisOffset);
+
+		OutBoneTransforms.Emplace(PelvisIndex, PelvisTransform);
+
+		for (auto* Leg : {&LeftLeg, &RightLeg})
+		{
+			Leg->Thigh.AddToTranslation(PelvisOffset);
+			Leg->Calf.AddToTranslation(PelvisOffset);
+			Leg->Foot.AddToTranslation(PelvisOffset);
+		}
+	}
+
+	AlsFeetAndHandsIkNode::SolveLeg(LeftLeg, RigInput.FootLeftIkLocation, RigInput.FootLeftIkRotation, RigInput.FootLeftIkAmount);
+	AlsFeetAndHandsIkNode::SolveLeg(RightLeg, RigInput.FootRightIkLocation, RigInput.FootRightIkRotation, RigInput.FootRightIkAmount);
+
+	OutBoneTransforms.Emplace(ThighLeftIndex, LeftLeg.Thigh);
+	OutBoneTransforms.Emplace(CalfLeftIndex, LeftLeg.Calf);
+	OutBoneTransforms.Emplace(FootLeftIndex, LeftLeg.Foot);
+
+	OutBoneTransforms.Emplace(ThighRightIndex, RightLeg.Thigh);
+	OutBoneTransforms.Emplace(CalfRightIndex, RightLeg.Calf);
+	OutBoneTransforms.Emplace(FootRightIndex, RightLeg.Foot);
+}
+
+void FAlsAnimNode_FeetAndHandsIk::EvaluateHandsIkRetargeting(FCSPose<FCompactPose>& Pose, const float PelvisOffsetZ,
+                                                             TArray<FBoneTransform>& OutBoneTransforms) const
+{
+	if (!FAnimWeight::IsRelevant(HandIkRetargetingAmount))
+	{
+		return;
+	}
+
+	const auto& RequiredBones{Pose.GetPose().GetBoneContainer()};
+	const FVector PelvisOffset{0.0f, 0.0f, PelvisOffsetZ};
+
+	// Bones under the pelvis have already been moved by the pelvis offset, but this is not yet reflected in the pose.
+
+	const auto GetBoneLocation{
+		[&Pose, &RequiredBones, &PelvisOffset](const FBoneReference& Bone, const bool bUnderPelvis)
+		{
+			const auto Location{Pose.GetComponentSpaceTransform(Bone.GetCompactPoseIndex(RequiredBones)).GetLocation()};
+
+			return bUnderPelvis ? Location + PelvisOffset : Location;
+		}
+	};
+
+	FVector RetargetingOffset;
+
+	if (FAnimWeight::IsFullWeight(HandIkRetargetingWeight))
+	{
+		RetargetingOffset = GetBoneLocation(HandRightBone, bHandRightUnderPelvis) -
+		                    GetBoneLocation(HandRightIkBone, bHandRightIkUnderPelvis);
+	}
+	else if (!FAnimWeight::IsRelevant(HandIkRetargetingWeight))
+	{
+		RetargetingOffset = GetBoneLocation(HandLeftBone, bHandLeftUnderPelvis) -
+		                    GetBoneLocation(HandLeftIkBone, bHandLeftIkUnderPelvis);
+	}
+	else
+	{
+		RetargetingOffset = FMath::Lerp(GetBoneLocation(HandLeftBone, bHandLeftUnderPelvis),
+		                                GetBoneLocation(HandRightBone, bHandRightUnderPelvis),
+		                                HandIkRetargetingWeight) -
+		                    FMath::Lerp(GetBoneLocation(HandLeftIkBone, bHandLeftIkUnderPelvis),
+		                                GetBoneLocation(HandRightIkBone, bHandRightIkUnderPelvis),
+		                                HandIkRetargetingWeight);
+	}
+
+	RetargetingOffset *= FMath::Min(1.0f, HandIkRetargetingAmount);
+
+	if (RetargetingOffset.IsNearlyZero())
+	{
+		return;
+	}
+
+	for (auto i{0}; i < HandIkBonesToMove.Num(); i++)
+	{
+		const auto BoneIndex{HandIkBonesToMove[i].GetCompactPoseIndex(RequiredBones)};
+		if (!BoneIndex.IsValid())
+		{
+			continue;
+		}
+
+		auto BoneTransform{Pose.GetComponentSpaceTransform(BoneIndex)};
+		BoneTransform.AddToTranslation(HandIkBonesToMoveUnderPelvis[i] ? RetargetingOffset + PelvisOffset : RetargetingOffset);
+
+		OutBoneTransforms.Emplace(BoneIndex, BoneTransform);
+	}
+}
+
+bool FAlsAnimNode_FeetAndHandsIk::IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones)
+{
+	return PelvisBone.IsValidToEvaluate(RequiredBones) &&
+	       FootLeftBone.IsValidToEvaluate(RequiredBones) && ThighLeftIndex.IsValid() && CalfLeftIndex.IsValid() &&
+	       FootRightBone.IsValidToEvaluate(RequiredBones) && ThighRightIndex.IsValid() && CalfRightIndex.IsValid() &&
+	       (!RigInput.bUseHandIkBones ||
+	        (HandLeftBone.IsValidToEvaluate(RequiredBones) && HandLeftIkBone.IsValidToEvaluate(RequiredBones) &&
+	         HandRightBone.IsValidToEvaluate(RequiredBones) && HandRightIkBone.IsValidToEvaluate(RequiredBones)));
+}
+
+void FAlsAnimNode_FeetAndHandsIk::InitializeBoneReferences(const FBoneContainer& RequiredBones)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+
+	PelvisBone.Initialize(RequiredBones);
+
+	// Bone indices are cached here once, so that they don't have to be looked up during evaluation.
+
+	static const auto InitializeLeg{
+		[](const FBoneContainer& RequiredBones, FBoneReference& FootBone,
+		   FCompactPoseBoneIndex& ThighIndex, FCompactPoseBoneIndex& CalfIndex)
+		{
+			FootBone.Initialize(RequiredBones);
+
+			ThighIndex = FCompactPoseBoneIndex{INDEX_NONE};
+			CalfIndex = FCompactPoseBoneIndex{INDEX_NONE};
+
+			if (FootBone.IsValidToEvaluate(RequiredBones))
+			{
+				CalfIndex = RequiredBones.GetParentBoneIndex(FootBone.GetCompactPoseIndex(RequiredBones));
+
+				if (CalfIndex.IsValid())
+				{
+					ThighIndex = RequiredBones.GetParentBoneIndex(CalfIndex);
+				}
+			}
+		}
+	};
+
+	InitializeLeg(RequiredBones, FootLeftBone, ThighLeftIndex, CalfLeftIndex);
+	InitializeLeg(RequiredBones, FootRightBone, ThighRightIndex, CalfRightIndex);
+
+	const auto PelvisIndex{PelvisBone.GetCompactPoseIndex(RequiredBones)};
+
+	const auto IsUnderPelvis{
+		[&RequiredBones, PelvisIndex](FBoneReference& Bone)
+		{
+			Bone.Initialize(RequiredBones);
+
+			return PelvisIndex.IsValid() && Bone.IsValidToEvaluate(RequiredBones) &&
+			       RequiredBones.BoneIsChildOf(Bone.GetCompactPoseIndex(RequiredBones), PelvisIndex);
+		}
+	};
+
+	bHandLeftUnderPelvis = IsUnderPelvis(HandLeftBone);
+	bHandLeftIkUnderPelvis = IsUnderPelvis(HandLeftIkBone);
+	bHandRightUnderPelvis = IsUnderPelvis(HandRightBone);
+	bHandRightIkUnderPelvis = IsUnderPelvis(HandRightIkBone);
+
+	HandIkBonesToMoveUnderPelvis.Reset();
+
+	for (auto& Bone : HandIkBonesToMove)
+	{
+		HandIkBonesToMoveUnderPelvis.Add(IsUnderPelvis(Bone));
+	}
+}
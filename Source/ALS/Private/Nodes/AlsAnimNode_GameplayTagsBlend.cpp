@@ -2,13 +2,65 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNode_GameplayTagsBlend)
 
+void FAlsAnimNode_GameplayTagsBlend::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+
+	const auto& CurrentTags{GetTags()};
+
+	ChildIndices.Reset();
+	ChildIndices.Reserve(CurrentTags.Num());
+
+	for (auto i{0}; i < CurrentTags.Num(); i++)
+	{
+		// If a tag is listed more than once, then its first occurrence is used.
+
+		ChildIndices.FindOrAdd(CurrentTags[i], i + 1);
+	}
+
+	PreviousActiveTag = FGameplayTag::EmptyTag;
+	PreviousActiveChildIndex = 0;
+
+	Super::Initialize_AnyThread(Context);
+}
+
 int32 FAlsAnimNode_GameplayTagsBlend::GetActiveChildIndex()
 {
 	const auto& CurrentActiveTag{GetActiveTag()};
 
-	return CurrentActiveTag.IsValid()
-		       ? GetTags().Find(CurrentActiveTag) + 1
-		       : 0;
+	if (CurrentActiveTag == PreviousActiveTag)
+	{
+		return PreviousActiveChildIndex;
+	}
+
+	PreviousActiveTag = CurrentActiveTag;
+	PreviousActiveChildIndex = 0;
+
+	if (!CurrentActiveTag.IsValid())
+	{
+		return PreviousActiveChildIndex;
+	}
+
+	const auto* ChildIndex{ChildIndices.Find(CurrentActiveTag)};
+
+	if (ChildIndex == nullptr && IsMatchTagHierarchy())
+	{
+		for (auto ParentTag{CurrentActiveTag.RequestDirectParent()}; ParentTag.IsValid(); ParentTag = ParentTag.RequestDirectParent())
+		{
+			ChildIndex = ChildIndices.Find(ParentTag);
+			if (ChildIndex != nullptr)
+			{
+				break;
+			}
+		}
+	}
+
+	if (ChildIndex != nullptr)
+	{
+		PreviousActiveChildIndex = *ChildIndex;
+	}
+
+	return PreviousActiveChildIndex;
 }
 
 const FGameplayTag& FAlsAnimNode_GameplayTagsBlend::GetActiveTag() const
@@ -21,6 +73,11 @@ const TArray<FGameplayTag>& FAlsAnimNode_GameplayTagsBlend::GetTags() const
 	return GET_ANIM_NODE_DATA(TArray<FGameplayTag>, Tags);
 }
 
+bool FAlsAnimNode_GameplayTagsBlend::IsMatchTagHierarchy() const
+{
+	return GET_ANIM_NODE_DATA(bool, bMatchTagHierarchy);
+}
+
 #if WITH_EDITOR
 void FAlsAnimNode_GameplayTagsBlend::RefreshPoses()
 {
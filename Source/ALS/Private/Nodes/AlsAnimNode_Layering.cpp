@@ -0,0 +1,310 @@
+#include "Nodes/AlsAnimNode_Layering.h"
+
+#include "AnimationRuntime.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "Animation/AnimTrace.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNode_Layering)
+
+namespace AlsLayeringNode
+{
+	static FTransform CalculateAdditive(const FTransform& Transform, const FTransform& ReferenceTransform)
+	{
+		FTransform Additive{
+			Transform.GetRotation() * ReferenceTransform.GetRotation().Inverse(),
+			Transform.GetTranslation() - ReferenceTransform.GetTranslation(),
+			Transform.GetScale3D() * FTransform::GetSafeScaleReciprocal(ReferenceTransform.GetScale3D())
+		};
+
+		Additive.NormalizeRotation();
+
+		return Additive;
+	}
+}
+
+void FAlsAnimNode_Layering::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+
+	Super::Initialize_AnyThread(Context);
+
+	BasePose.Initialize(Context);
+	BaseReferencePose.Initialize(Context);
+	OverlayPose.Initialize(Context);
+	SlotPose.Initialize(Context);
+}
+
+void FAlsAnimNode_Layering::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+
+	Super::CacheBones_AnyThread(Context);
+
+	BasePose.CacheBones(Context);
+	BaseReferencePose.CacheBones(Context);
+	OverlayPose.CacheBones(Context);
+	SlotPose.CacheBones(Context);
+
+	// Assign each bone to the deepest region it belongs to. Parents always come before their
+	// children in the compact pose, so a single pass is enough to propagate regions down the hierarchy.
+
+	const auto& RequiredBones{Context.AnimInstanceProxy->GetRequiredBones()};
+	const auto BonesCount{RequiredBones.GetCompactPoseNumBones()};
+
+	BoneRegions.Init(ERegion::Count, BonesCount);
+
+	const auto AssignRegion{
+		[this, &RequiredBones](FBoneReference& Bone, const ERegion Region)
+		{
+			Bone.Initialize(RequiredBones);
+
+			if (Bone.IsValidToEvaluate(RequiredBones))
+			{
+				BoneRegions[Bone.GetCompactPoseIndex(RequiredBones).GetInt()] = Region;
+			}
+		}
+	};
+
+	AssignRegion(LegLeftBone, ERegion::Legs);
+	AssignRegion(LegRightBone, ERegion::Legs);
+	AssignRegion(SpineBone, ERegion::Spine);
+	AssignRegion(HeadBone, ERegion::Head);
+	AssignRegion(ArmLeftBone, ERegion::ArmLeft);
+	AssignRegion(ArmRightBone, ERegion::ArmRight);
+	AssignRegion(HandLeftBone, ERegion::HandLeft);
+	AssignRegion(HandRightBone, ERegion::HandRight);
+
+	for (auto i{0}; i < BonesCount; i++)
+	{
+		const FCompactPoseBoneIndex BoneIndex{i};
+
+		if (BoneRegions[BoneIndex.GetInt()] != ERegion::Count)
+		{
+			continue;
+		}
+
+		const auto ParentIndex{RequiredBones.GetParentBoneIndex(BoneIndex)};
+
+		BoneRegions[BoneIndex.GetInt()] = ParentIndex.IsValid() ? BoneRegions[ParentIndex.GetInt()] : ERegion::Pelvis;
+	}
+}
+
+void FAlsAnimNode_Layering::Update_AnyThread(const FAnimationUpdateContext& Context)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+
+	Super::Update_AnyThread(Context);
+
+	GetEvaluateGraphExposedInputs().Execute(Context);
+
+	// The slot pose is always updated, otherwise montages playing in the slot would not receive their slot weight.
+
+	SlotPose.Update(Context);
+
+	RefreshRegionBlends(Context.AnimInstanceProxy->GetSlotNodeGlobalWeight(SlotName));
+
+	BasePose.Update(Context);
+
+	if (bOverlayRelevant)
+	{
+		OverlayPose.Update(Context);
+	}
+
+	if (bAdditiveRelevant)
+	{
+		BaseReferencePose.Update(Context);
+	}
+
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Overlay Relevant"), bOverlayRelevant);
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Additive Relevant"), bAdditiveRelevant);
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Slot Relevant"), bSlotRelevant);
+}
+
+void FAlsAnimNode_Layering::RefreshRegionBlends(const float SlotWeight)
+{
+	const auto bSlotActive{FAnimWeight::IsRelevant(SlotWeight)};
+	const auto& State{LayeringState};
+
+	SetRegionBlend(ERegion::Pelvis, State.PelvisBlendAmount, 0.0f, 1.0f, 0.0f,
+	               bSlotActive ? State.PelvisSlotBlendAmount : 0.0f);
+
+	SetRegionBlend(ERegion::Legs, State.LegsBlendAmount, 0.0f, 1.0f, 0.0f,
+	               bSlotActive ? State.LegsSlotBlendAmount : 0.0f);
+
+	SetRegionBlend(ERegion::Spine, State.SpineBlendAmount, State.SpineAdditiveBlendAmount, 1.0f, 0.0f,
+	               bSlotActive ? State.SpineSlotBlendAmount : 0.0f);
+
+	SetRegionBlend(ERegion::Head, State.HeadBlendAmount, State.HeadAdditiveBlendAmount, 1.0f, 0.0f,
+	               bSlotActive ? State.HeadSlotBlendAmount : 0.0f);
+
+	SetRegionBlend(ERegion::ArmLeft, State.ArmLeftBlendAmount, State.ArmLeftAdditiveBlendAmount,
+	               State.ArmLeftLocalSpaceBlendAmount, State.ArmLeftMeshSpaceBlendAmount,
+	               bSlotActive ? State.ArmLeftSlotBlendAmount : 0.0f);
+
+	SetRegionBlend(ERegion::ArmRight, State.ArmRightBlendAmount, State.ArmRightAdditiveBlendAmount,
+	               State.ArmRightLocalSpaceBlendAmount, State.ArmRightMeshSpaceBlendAmount,
+	               bSlotActive ? State.ArmRightSlotBlendAmount : 0.0f);
+
+	// Hands share the additive and slot settings of their arms, but have their own overlay blend amount.
+
+	SetRegionBlend(ERegion::HandLeft, State.HandLeftBlendAmount, State.ArmLeftAdditiveBlendAmount,
+	               State.ArmLeftLocalSpaceBlendAmount, State.ArmLeftMeshSpaceBlendAmount,
+	               bSlotActive ? State.ArmLeftSlotBlendAmount : 0.0f);
+
+	SetRegionBlend(ERegion::HandRight, State.HandRightBlendAmount, State.ArmRightAdditiveBlendAmount,
+	               State.ArmRightLocalSpaceBlendAmount, State.ArmRightMeshSpaceBlendAmount,
+	               bSlotActive ? State.ArmRightSlotBlendAmount : 0.0f);
+
+	bOverlayRelevant = false;
+	bAdditiveRelevant = false;
+	bMeshSpaceAdditiveRelevant = false;
+	bSlotRelevant = false;
+
+	for (const auto& RegionBlend : RegionBlends)
+	{
+		bOverlayRelevant |= FAnimWeight::IsRelevant(RegionBlend.OverlayAmount);
+		bAdditiveRelevant |= FAnimWeight::IsRelevant(RegionBlend.OverlayAmount) && FAnimWeight::IsRelevant(RegionBlend.AdditiveAmount);
+		bMeshSpaceAdditiveRelevant |= FAnimWeight::IsRelevant(RegionBlend.OverlayAmount) && RegionBlend.bMeshSpaceAdditive;
+		bSlotRelevant |= FAnimWeight::IsRelevant(RegionBlend.SlotAmount);
+	}
+}
+
+void FAlsAnimNode_Layering::SetRegionBlend(const ERegion Region, const float OverlayAmount, const float AdditiveAmount,
+                                           const float LocalSpaceAmount, const float MeshSpaceAmount, const float SlotAmount)
+{
+	auto& RegionBlend{RegionBlends[static_cast<uint8>(Region)]};
+
+	RegionBlend.OverlayAmount = FMath::Clamp(OverlayAmount, 0.0f, 1.0f);
+	RegionBlend.AdditiveAmount = FMath::Clamp(AdditiveAmount, 0.0f, 1.0f);
+	RegionBlend.LocalSpaceAmount = FMath::Clamp(LocalSpaceAmount, 0.0f, 1.0f);
+	RegionBlend.SlotAmount = FMath::Clamp(SlotAmount, 0.0f, 1.0f);
+
+	RegionBlend.bMeshSpaceAdditive = FAnimWeight::IsRelevant(RegionBlend.AdditiveAmount) &&
+	                                 FAnimWeight::IsRelevant(MeshSpaceAmount) &&
+	                                 !FAnimWeight::IsFullWeight(RegionBlend.LocalSpaceAmount);
+
+	RegionBlend.bRelevant = FAnimWeight::IsRelevant(RegionBlend.OverlayAmount) || FAnimWeight::IsRelevant(RegionBlend.SlotAmount);
+}
+
+void FAlsAnimNode_Layering::Evaluate_AnyThread(FPoseContext& Output)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_FUNC()
+	ANIM_MT_SCOPE_CYCLE_COUNTER_VERBOSE(Layering, !IsInGameThread());
+
+	Super::Evaluate_AnyThread(Output);
+
+	BasePose.Evaluate(Output);
+
+	if ((!bOverlayRelevant && !bSlotRelevant) || BoneRegions.Num() != Output.Pose.GetNum())
+	{
+		return;
+	}
+
+	FPoseContext OverlayContext{Output};
+	FPoseContext ReferenceContext{Output};
+	FPoseContext MeshSpaceOverlayContext{Output};
+	FPoseContext SlotContext{Output};
+
+	if (bOverlayRelevant)
+	{
+		OverlayPose.Evaluate(OverlayContext);
+
+		// Layering curves usually come from the overlay animations, so they override the base pose curves.
+
+		Output.Curve.Combine(OverlayContext.Curve);
+	}
+
+	if (bAdditiveRelevant)
+	{
+		BaseReferencePose.Evaluate(ReferenceContext);
+	}
+
+	if (bMeshSpaceAdditiveRelevant)
+	{
+		// Mesh space additives can't be calculated per bone, so the overlay pose with the full
+		// mesh space base additive applied is calculated once, and then blended per region.
+
+		FPoseContext MeshSpaceAdditiveContext{Output};
+		MeshSpaceAdditiveContext.Pose.CopyBonesFrom(Output.Pose);
+
+		FPoseContext MeshSpaceReferenceContext{Output};
+		MeshSpaceReferenceContext.Pose.CopyBonesFrom(ReferenceContext.Pose);
+
+		FAnimationRuntime::ConvertPoseToMeshRotationPose(MeshSpaceAdditiveContext.Pose);
+		FAnimationRuntime::ConvertPoseToMeshRotationPose(MeshSpaceReferenceContext.Pose);
+		FAnimationRuntime::ConvertPoseToAdditive(MeshSpaceAdditiveContext.Pose, MeshSpaceReferenceContext.Pose);
+
+		MeshSpaceOverlayContext.Pose.CopyBonesFrom(OverlayContext.Pose);
+
+		FAnimationPoseData MeshSpaceOverlayPoseData{MeshSpaceOverlayContext};
+		const FAnimationPoseData MeshSpaceAdditivePoseData{MeshSpaceAdditiveContext};
+
+		FAnimationRuntime::AccumulateMeshSpaceRotationAdditiveToLocalPose(MeshSpaceOverlayPoseData, MeshSpaceAdditivePoseData, 1.0f);
+	}
+
+	if (bSlotRelevant)
+	{
+		SlotPose.Evaluate(SlotContext);
+
+		Output.Curve.Combine(SlotContext.Curve);
+	}
+
+	for (const auto BoneIndex : Output.Pose.ForEachBoneIndex())
+	{
+		const auto& RegionBlend{RegionBlends[static_cast<uint8>(BoneRegions[BoneIndex.GetInt()])]};
+		if (!RegionBlend.bRelevant)
+		{
+			continue;
+		}
+
+		auto& Transform{Output.Pose[BoneIndex]};
+
+		if (FAnimWeight::IsRelevant(RegionBlend.OverlayAmount))
+		{
+			auto LayerTransform{OverlayContext.Pose[BoneIndex]};
+
+			if (FAnimWeight::IsRelevant(RegionBlend.AdditiveAmount))
+			{
+				auto LocalSpaceLayerTransform{LayerTransform};
+
+				FTransform::BlendFromIdentityAndAccumulate(
+					LocalSpaceLayerTransform, AlsLayeringNode::CalculateAdditive(Transform, ReferenceContext.Pose[BoneIndex]),
+					ScalarRegister{RegionBlend.AdditiveAmount});
+
+				if (RegionBlend.bMeshSpaceAdditive)
+				{
+					LayerTransform.BlendWith(MeshSpaceOverlayContext.Pose[BoneIndex], RegionBlend.AdditiveAmount);
+					LayerTransform.BlendWith(LocalSpaceLayerTransform, RegionBlend.LocalSpaceAmount);
+				}
+				else
+				{
+					LayerTransform = LocalSpaceLayerTransform;
+				}
+			}
+
+			Transform.BlendWith(LayerTransform, RegionBlend.OverlayAmount);
+		}
+
+		if (FAnimWeight::IsRelevant(RegionBlend.SlotAmount))
+		{
+			Transform.BlendWith(SlotContext.Pose[BoneIndex], RegionBlend.SlotAmount);
+		}
+	}
+}
+
+void FAlsAnimNode_Layering::GatherDebugData(FNodeDebugData& DebugData)
+{
+	DECLARE_SCOPE_HIERARCHICAL_COUNTER_ANIMNODE(GatherDebugData)
+
+	TStringBuilder<256> DebugItemBuilder;
+
+	DebugItemBuilder << DebugData.GetNodeName(this) << TEXTVIEW(": Overlay: ") << (bOverlayRelevant ? TEXTVIEW("Yes") : TEXTVIEW("No"))
+		<< TEXTVIEW(", Additive: ") << (bAdditiveRelevant ? TEXTVIEW("Yes") : TEXTVIEW("No"))
+		<< TEXTVIEW(", Slot: ") << (bSlotRelevant ? TEXTVIEW("Yes") : TEXTVIEW("No"));
+
+	DebugData.AddDebugItem(FString{DebugItemBuilder});
+	BasePose.GatherDebugData(DebugData.BranchFlow(1.0f));
+	OverlayPose.GatherDebugData(DebugData.BranchFlow(bOverlayRelevant ? 1.0f : 0.0f));
+	BaseReferencePose.GatherDebugData(DebugData.BranchFlow(bAdditiveRelevant ? 1.0f : 0.0f));
+	SlotPose.GatherDebugData(DebugData.BranchFlow(bSlotRelevant ? 1.0f : 0.0f));
+}
@@ -1,7 +1,7 @@
 #include "Notifies/AlsAnimNotify_FootstepEffects.h"
 
+#include "AlsAnimationInstance.h"
 #include "AlsCharacter.h"
-#include "DrawDebugHelpers.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Animation/AnimInstance.h"
 #include "Components/AudioComponent.h"
@@ -9,9 +9,12 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
+#include "Notifies/AlsFootstepEffectsSubsystem.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Settings/AlsAnimationInstanceSettings.h"
 #include "Sound/SoundBase.h"
 #include "Utility/AlsConstants.h"
+#include "Utility/AlsDebugDrawSubsystem.h"
 #include "Utility/AlsEnumUtility.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
@@ -19,6 +22,8 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNotify_FootstepEffects)
 
+static_assert(UAlsFootstepEffectsSettings::SurfaceTypesCount == SurfaceType_Max);
+
 #if WITH_EDITOR
 void FAlsFootstepEffectSettings::PostEditChangeProperty(const FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -42,10 +47,62 @@ void UAlsFootstepEffectsSettings::PostEditChangeProperty(FPropertyChangedEvent&
 		}
 	}
 
+	RefreshEffectsLookup();
+
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 }
 #endif
 
+void UAlsFootstepEffectsSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	RefreshEffectsLookup();
+}
+
+void UAlsFootstepEffectsSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	RefreshEffectsLookup();
+}
+
+void UAlsFootstepEffectsSettings::RefreshEffectsLookup()
+{
+	EffectsLookupSettings.Reset(Effects.Num());
+
+	for (auto& Index : EffectsLookup)
+	{
+		Index = INDEX_NONE;
+	}
+
+	for (const auto& Tuple : Effects)
+	{
+		const auto Index{EffectsLookupSettings.Add(Tuple.Value)};
+		const auto SurfaceIndex{static_cast<int32>(Tuple.Key.GetValue())};
+
+		if (SurfaceIndex >= 0 && SurfaceIndex < SurfaceTypesCount)
+		{
+			EffectsLookup[SurfaceIndex] = Index;
+		}
+	}
+
+	if (EffectsLookupSettings.IsEmpty())
+	{
+		return;
+	}
+
+	// Surface types not present in the map use the first entry of the map.
+
+	for (auto& Index : EffectsLookup)
+	{
+		if (Index == INDEX_NONE)
+		{
+			Index = 0;
+		}
+	}
+}
+
 FString UAlsAnimNotify_FootstepEffects::GetNotifyName_Implementation() const
 {
 	TStringBuilder<64> NotifyNameBuilder;
@@ -72,11 +129,16 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 		return;
 	}
 
+	const auto* World{Mesh->GetWorld()};
+
 #if ENABLE_DRAW_DEBUG
-	const auto bDisplayDebug{UAlsUtility::ShouldDisplayDebugForActor(Mesh->GetOwner(), UAlsConstants::TracesDebugDisplayName())};
+	auto* DebugDrawSubsystem{
+		UAlsUtility::ShouldDisplayDebugForActor(Mesh->GetOwner(), UAlsConstants::TracesDebugDisplayName())
+			? World->GetSubsystem<UAlsDebugDrawSubsystem>()
+			: nullptr
+	};
 #endif
 
-	const auto* World{Mesh->GetWorld()};
 	const auto MeshScale{Mesh->GetComponentScale().Z};
 
 	const auto& FootBoneName{FootBone == EAlsFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
@@ -88,30 +150,55 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 			                                     : FVector{FootstepEffectsSettings->FootRightZAxis})
 	};
 
-	FCollisionQueryParams QueryParameters{__FUNCTION__, true, Mesh->GetOwner()};
-	QueryParameters.bReturnPhysicalMaterial = true;
-
 	FHitResult FootstepHit;
-	if (!World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
-	                                     FootTransform.GetLocation() - FootZAxis *
-	                                     (FootstepEffectsSettings->SurfaceTraceDistance * MeshScale),
-	                                     FootstepEffectsSettings->SurfaceTraceChannel, QueryParameters))
+
+	const auto* AnimationInstance{Cast<UAlsAnimationInstance>(Mesh->GetAnimInstance())};
+	const auto* AnimationSettings{IsValid(AnimationInstance) ? AnimationInstance->GetSettingsUnsafe() : nullptr};
+
+	// The foot IK ground hit is reused only if it was traced against the same channel as the surface
+	// trace, otherwise it may have hit a different surface than the surface trace would have.
+
+	const auto* FootState{
+		IsValid(AnimationSettings) && AnimationSettings->Feet.IkTraceChannel == FootstepEffectsSettings->SurfaceTraceChannel
+			? FootBone == EAlsFootBone::Left
+				  ? &AnimationInstance->GetFeetState().Left
+				  : &AnimationInstance->GetFeetState().Right
+			: nullptr
+	};
+
+	if (FootState != nullptr && FootState->GroundHit.bBlockingHit && FootstepEffectsSettings->FootIkGroundHitMaxAge > 0.0f &&
+	    World->TimeSince(FootState->GroundHitTime) <= FootstepEffectsSettings->FootIkGroundHitMaxAge)
 	{
-		// As a fallback, trace down the world Z axis if the first trace didn't hit anything.
+		// The foot IK trace has recently found the ground under this foot, so there is no need to trace it again.
 
-		World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
-		                                FootTransform.GetLocation() - FVector{
-			                                0.0f, 0.0f, FootstepEffectsSettings->SurfaceTraceDistance * MeshScale
-		                                }, FootstepEffectsSettings->SurfaceTraceChannel, QueryParameters);
+		FootstepHit = FootState->GroundHit;
 	}
+	else
+	{
+		FCollisionQueryParams QueryParameters{__FUNCTION__, true, Mesh->GetOwner()};
+		QueryParameters.bReturnPhysicalMaterial = true;
+
+		if (!World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
+		                                     FootTransform.GetLocation() - FootZAxis *
+		                                     (FootstepEffectsSettings->SurfaceTraceDistance * MeshScale),
+		                                     FootstepEffectsSettings->SurfaceTraceChannel, QueryParameters))
+		{
+			// As a fallback, trace down the world Z axis if the first trace didn't hit anything.
+
+			World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
+			                                FootTransform.GetLocation() - FVector{
+				                                0.0f, 0.0f, FootstepEffectsSettings->SurfaceTraceDistance * MeshScale
+			                                }, FootstepEffectsSettings->SurfaceTraceChannel, QueryParameters);
+		}
 
 #if ENABLE_DRAW_DEBUG
-	if (bDisplayDebug)
-	{
-		UAlsUtility::DrawDebugLineTraceSingle(World, FootstepHit.TraceStart, FootstepHit.TraceEnd, FootstepHit.bBlockingHit,
-		                                      FootstepHit, {0.333333f, 0.0f, 0.0f}, FLinearColor::Red, 10.0f);
-	}
+		if (IsValid(DebugDrawSubsystem))
+		{
+			DebugDrawSubsystem->QueueLineTraceSingle(FootstepHit.TraceStart, FootstepHit.TraceEnd, FootstepHit.bBlockingHit,
+			                                         FootstepHit, {0.333333f, 0.0f, 0.0f}, FLinearColor::Red, 10.0f);
+		}
 #endif
+	}
 
 	if (!FootstepHit.bBlockingHit)
 	{
@@ -119,20 +206,11 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	}
 
 	const auto SurfaceType{FootstepHit.PhysMaterial.IsValid() ? FootstepHit.PhysMaterial->SurfaceType.GetValue() : SurfaceType_Default};
-	const auto* EffectSettings{FootstepEffectsSettings->Effects.Find(SurfaceType)};
+	const auto* EffectSettings{FootstepEffectsSettings->FindEffectSettings(SurfaceType)};
 
 	if (EffectSettings == nullptr)
 	{
-		for (const auto& Tuple : FootstepEffectsSettings->Effects)
-		{
-			EffectSettings = &Tuple.Value;
-			break;
-		}
-
-		if (EffectSettings == nullptr)
-		{
-			return;
-		}
+		return;
 	}
 
 	const auto FootstepLocation{FootstepHit.ImpactPoint};
@@ -145,10 +223,10 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	};
 
 #if ENABLE_DRAW_DEBUG
-	if (bDisplayDebug)
+	if (IsValid(DebugDrawSubsystem))
 	{
-		DrawDebugCoordinateSystem(World, FootstepLocation, FootstepRotation.Rotator(),
-		                          25.0f, false, 10.0f, 0, UAlsUtility::DrawLineThickness);
+		DebugDrawSubsystem->QueueCoordinateSystem(FootstepLocation, FootstepRotation,
+		                                          25.0f, 10.0f, UAlsUtility::DrawLineThickness);
 	}
 #endif
 
@@ -246,6 +324,26 @@ void UAlsAnimNotify_FootstepEffects::SpawnDecal(USkeletalMeshComponent* Mesh, co
 		FootstepLocation + DecalRotation.RotateVector(FVector{EffectSettings.DecalLocationOffset} * MeshScale)
 	};
 
+	auto* EffectsSubsystem{Mesh->GetWorld()->GetSubsystem<UAlsFootstepEffectsSubsystem>()};
+	if (IsValid(EffectsSubsystem))
+	{
+		FAlsFootstepDecalRequest Request;
+		Request.Material = EffectSettings.DecalMaterial.Get();
+		Request.Location = DecalLocation;
+		Request.Rotation = DecalRotation;
+		Request.Size = FVector{EffectSettings.DecalSize} * MeshScale;
+		Request.Duration = EffectSettings.DecalDuration;
+		Request.FadeOutDuration = EffectSettings.DecalFadeOutDuration;
+
+		if (EffectSettings.DecalSpawnMode == EAlsFootstepDecalSpawnMode::SpawnAttachedToTraceHitComponent)
+		{
+			Request.AttachComponent = FootstepHit.Component;
+		}
+
+		EffectsSubsystem->QueueDecal(MoveTemp(Request));
+		return;
+	}
+
 	UDecalComponent* Decal{nullptr};
 
 	if (EffectSettings.DecalSpawnMode == EAlsFootstepDecalSpawnMode::SpawnAtTraceHitLocation || !FootstepHit.Component.IsValid())
@@ -278,6 +376,10 @@ void UAlsAnimNotify_FootstepEffects::SpawnParticleSystem(USkeletalMeshComponent*
 
 	const auto MeshScale{Mesh->GetComponentScale().Z};
 
+	// The footstep effects subsystem is not available in editor preview worlds, so particle systems are spawned directly there.
+
+	auto* EffectsSubsystem{Mesh->GetWorld()->GetSubsystem<UAlsFootstepEffectsSubsystem>()};
+
 	if (EffectSettings.ParticleSystemSpawnMode == EAlsFootstepParticleEffectSpawnMode::SpawnAtTraceHitLocation)
 	{
 		const auto ParticleSystemRotation{
@@ -293,6 +395,18 @@ void UAlsAnimNotify_FootstepEffects::SpawnParticleSystem(USkeletalMeshComponent*
 			ParticleSystemRotation.RotateVector(FVector{EffectSettings.ParticleSystemLocationOffset} * MeshScale)
 		};
 
+		if (IsValid(EffectsSubsystem))
+		{
+			FAlsFootstepParticleSystemRequest Request;
+			Request.System = EffectSettings.ParticleSystem.Get();
+			Request.Location = ParticleSystemLocation;
+			Request.Rotation = ParticleSystemRotation;
+			Request.Scale = FVector::OneVector * MeshScale;
+
+			EffectsSubsystem->QueueParticleSystem(MoveTemp(Request));
+			return;
+		}
+
 		UNiagaraFunctionLibrary::SpawnSystemAtLocation(Mesh->GetWorld(), EffectSettings.ParticleSystem.Get(),
 		                                               ParticleSystemLocation, ParticleSystemRotation.Rotator(),
 		                                               FVector::OneVector * MeshScale, true, true, ENCPoolMethod::AutoRelease);
@@ -301,6 +415,24 @@ void UAlsAnimNotify_FootstepEffects::SpawnParticleSystem(USkeletalMeshComponent*
 	{
 		const auto& FootBoneName{FootBone == EAlsFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
 
+		if (IsValid(EffectsSubsystem))
+		{
+			FAlsFootstepParticleSystemRequest Request;
+			Request.System = EffectSettings.ParticleSystem.Get();
+			Request.AttachComponent = Mesh;
+			Request.AttachSocketName = FootBoneName;
+			Request.Location = FVector{EffectSettings.ParticleSystemLocationOffset} * MeshScale;
+			Request.Rotation = FQuat{
+				FootBone == EAlsFootBone::Left
+					? EffectSettings.ParticleSystemFootLeftRotationOffsetQuaternion
+					: EffectSettings.ParticleSystemFootRightRotationOffsetQuaternion
+			};
+			Request.Scale = FVector::OneVector * MeshScale;
+
+			EffectsSubsystem->QueueParticleSystem(MoveTemp(Request));
+			return;
+		}
+
 		UNiagaraFunctionLibrary::SpawnSystemAttached(EffectSettings.ParticleSystem.Get(), Mesh, FootBoneName,
 		                                             FVector{EffectSettings.ParticleSystemLocationOffset} * MeshScale,
 		                                             FRotator{
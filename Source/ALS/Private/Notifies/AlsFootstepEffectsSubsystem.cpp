@@ -0,0 +1,291 @@
+#include "Notifies/AlsFootstepEffectsSubsystem.h"
+
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Components/DecalComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsFootstepEffectsSubsystem)
+
+bool UAlsFootstepEffectsSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Decals and particle systems are never rendered on a dedicated server.
+
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UAlsFootstepEffectsSubsystem::Deinitialize()
+{
+	for (const auto& PooledDecal : Decals)
+	{
+		if (IsValid(PooledDecal.Decal))
+		{
+			PooledDecal.Decal->DestroyComponent();
+		}
+	}
+
+	Decals.Reset();
+	NextDecalIndex = 0;
+
+	LiveParticleSystems.Reset();
+
+	PendingDecals.Reset();
+	PendingParticleSystems.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAlsFootstepEffectsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsFootstepEffectsSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsFootstepEffectsSubsystem::Tick()"), STAT_UAlsFootstepEffectsSubsystem_Tick, STATGROUP_Als)
+
+	Super::Tick(DeltaTime);
+
+	RefreshDecals();
+	RefreshParticleSystems();
+}
+
+TStatId UAlsFootstepEffectsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsFootstepEffectsSubsystem, STATGROUP_Als)
+}
+
+bool UAlsFootstepEffectsSubsystem::QueueDecal(FAlsFootstepDecalRequest&& Request)
+{
+	Request.ViewDistanceSquared = CalculateViewDistanceSquared(Request.Location);
+
+	if (!IsWithinSpawnDistance(Request.ViewDistanceSquared))
+	{
+		return false;
+	}
+
+	PendingDecals.Emplace(MoveTemp(Request));
+	return true;
+}
+
+bool UAlsFootstepEffectsSubsystem::QueueParticleSystem(FAlsFootstepParticleSystemRequest&& Request)
+{
+	Request.ViewDistanceSquared = CalculateViewDistanceSquared(Request.AttachComponent.IsValid()
+		                                                           ? Request.AttachComponent->GetSocketLocation(Request.AttachSocketName)
+		                                                           : Request.Location);
+
+	if (!IsWithinSpawnDistance(Request.ViewDistanceSquared))
+	{
+		return false;
+	}
+
+	PendingParticleSystems.Emplace(MoveTemp(Request));
+	return true;
+}
+
+float UAlsFootstepEffectsSubsystem::CalculateViewDistanceSquared(const FVector& Location)
+{
+	if (ViewLocationsFrame != GFrameCounter)
+	{
+		// View locations are gathered only once per frame, no matter how many footsteps are queued.
+
+		ViewLocationsFrame = GFrameCounter;
+		ViewLocations.Reset();
+
+		for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+		{
+			const auto* Player{Iterator->Get()};
+
+			if (IsValid(Player) && Player->IsLocalController())
+			{
+				FVector ViewLocation;
+				FRotator ViewRotation;
+
+				Player->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+				ViewLocations.Add(ViewLocation);
+			}
+		}
+	}
+
+	if (ViewLocations.IsEmpty())
+	{
+		// Nobody can see the footstep, for example on a dedicated server started from the editor.
+
+		return TNumericLimits<float>::Max();
+	}
+
+	auto ViewDistanceSquared{TNumericLimits<float>::Max()};
+
+	for (const auto& ViewLocation : ViewLocations)
+	{
+		ViewDistanceSquared = FMath::Min(ViewDistanceSquared, UE_REAL_TO_FLOAT(FVector::DistSquared(Location, ViewLocation)));
+	}
+
+	return ViewDistanceSquared;
+}
+
+void UAlsFootstepEffectsSubsystem::RefreshDecals()
+{
+	if (!PendingDecals.IsEmpty())
+	{
+		// Requests that do not fit into the per-frame budget are discarded, since footstep effects are
+		// short-lived and there is no point in spawning them late. The closest footsteps go first.
+
+		PendingDecals.Sort([](const FAlsFootstepDecalRequest& A, const FAlsFootstepDecalRequest& B)
+		{
+			return A.ViewDistanceSquared < B.ViewDistanceSquared;
+		});
+
+		const auto SpawnCount{FMath::Min(PendingDecals.Num(), MaxDecalsPerFrame)};
+
+		for (auto i{0}; i < SpawnCount; i++)
+		{
+			SpawnDecal(PendingDecals[i]);
+		}
+
+		PendingDecals.Reset();
+	}
+
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+
+	for (auto& PooledDecal : Decals)
+	{
+		if (PooledDecal.ExpirationTime > 0.0 && PooledDecal.ExpirationTime <= WorldTime)
+		{
+			PooledDecal.ExpirationTime = 0.0;
+
+			if (IsValid(PooledDecal.Decal))
+			{
+				PooledDecal.Decal->SetVisibility(false);
+			}
+		}
+	}
+}
+
+void UAlsFootstepEffectsSubsystem::SpawnDecal(const FAlsFootstepDecalRequest& Request)
+{
+	if (!IsValid(Request.Material))
+	{
+		return;
+	}
+
+	FAlsPooledFootstepDecal* PooledDecal;
+
+	if (Decals.Num() < MaxLiveDecals)
+	{
+		PooledDecal = &Decals.AddDefaulted_GetRef();
+	}
+	else
+	{
+		// Reuse the oldest decal.
+
+		NextDecalIndex %= Decals.Num();
+
+		PooledDecal = &Decals[NextDecalIndex];
+		NextDecalIndex += 1;
+	}
+
+	auto* Decal{PooledDecal->Decal.Get()};
+
+	if (IsValid(Decal))
+	{
+		Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+	else
+	{
+		Decal = NewObject<UDecalComponent>(this, NAME_None, RF_Transient);
+		Decal->SetUsingAbsoluteScale(true);
+		Decal->RegisterComponentWithWorld(GetWorld());
+
+		PooledDecal->Decal = Decal;
+	}
+
+	Decal->DecalSize = Request.Size;
+	Decal->SetDecalMaterial(Request.Material);
+	Decal->SetWorldLocationAndRotation(Request.Location, Request.Rotation);
+
+	if (Request.AttachComponent.IsValid())
+	{
+		Decal->AttachToComponent(Request.AttachComponent.Get(), FAttachmentTransformRules::KeepWorldTransform);
+	}
+
+	Decal->SetVisibility(true);
+	Decal->MarkRenderStateDirty();
+
+	Decal->SetFadeOut(Request.Duration, Request.FadeOutDuration, false);
+
+	// The lifespan timer started by UDecalComponent::SetFadeOut() destroys the component, so it is
+	// cleared here, and instead the decal is hidden by the subsystem once it has completely faded out.
+
+	Decal->SetLifeSpan(0.0f);
+
+	const auto LifeSpan{Request.Duration + Request.FadeOutDuration};
+
+	PooledDecal->ExpirationTime = LifeSpan > 0.0f ? GetWorld()->GetTimeSeconds() + LifeSpan : 0.0;
+}
+
+void UAlsFootstepEffectsSubsystem::RefreshParticleSystems()
+{
+	if (PendingParticleSystems.IsEmpty())
+	{
+		return;
+	}
+
+	LiveParticleSystems.RemoveAllSwap([](const TWeakObjectPtr<UNiagaraComponent>& ParticleSystem)
+	{
+		return !ParticleSystem.IsValid() || !ParticleSystem->IsActive();
+	});
+
+	PendingParticleSystems.Sort([](const FAlsFootstepParticleSystemRequest& A, const FAlsFootstepParticleSystemRequest& B)
+	{
+		return A.ViewDistanceSquared < B.ViewDistanceSquared;
+	});
+
+	const auto SpawnCount{
+		FMath::Min3(PendingParticleSystems.Num(), MaxParticleSystemsPerFrame, MaxLiveParticleSystems - LiveParticleSystems.Num())
+	};
+
+	for (auto i{0}; i < SpawnCount; i++)
+	{
+		SpawnParticleSystem(PendingParticleSystems[i]);
+	}
+
+	PendingParticleSystems.Reset();
+}
+
+void UAlsFootstepEffectsSubsystem::SpawnParticleSystem(const FAlsFootstepParticleSystemRequest& Request)
+{
+	if (!IsValid(Request.System))
+	{
+		return;
+	}
+
+	UNiagaraComponent* ParticleSystem;
+
+	if (Request.AttachComponent.IsExplicitlyNull())
+	{
+		ParticleSystem = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), Request.System, Request.Location,
+		                                                                Request.Rotation.Rotator(), Request.Scale,
+		                                                                true, true, ENCPoolMethod::AutoRelease);
+	}
+	else if (Request.AttachComponent.IsValid())
+	{
+		ParticleSystem = UNiagaraFunctionLibrary::SpawnSystemAttached(Request.System, Request.AttachComponent.Get(),
+		                                                              Request.AttachSocketName, Request.Location,
+		                                                              Request.Rotation.Rotator(), Request.Scale,
+		                                                              EAttachLocation::KeepRelativeOffset,
+		                                                              true, ENCPoolMethod::AutoRelease);
+	}
+	else
+	{
+		return;
+	}
+
+	if (IsValid(ParticleSystem))
+	{
+		LiveParticleSystems.Emplace(ParticleSystem);
+	}
+}
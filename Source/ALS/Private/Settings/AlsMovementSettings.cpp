@@ -0,0 +1,95 @@
+#include "Settings/AlsMovementSettings.h"
+
+#include "AlsCharacterMovementComponent.h"
+#include "Curves/CurveVector.h"
+#include "Utility/AlsMacros.h"
+#include "UObject/UObjectIterator.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMovementSettings)
+
+void FAlsMovementGaitSettings::RefreshAccelerationAndDecelerationAndGroundFrictionTable()
+{
+	AccelerationAndDecelerationAndGroundFrictionTable.Reset();
+	AccelerationAndDecelerationAndGroundFrictionTableCurve = AccelerationAndDecelerationAndGroundFrictionCurve;
+
+	if (!IsValid(AccelerationAndDecelerationAndGroundFrictionCurve))
+	{
+		return;
+	}
+
+	// Gait amount ranges from 0 to 3, so the table contains 3 gaits worth of samples plus the last sample.
+
+	static constexpr auto SamplesCount{AccelerationAndDecelerationAndGroundFrictionTableResolution * 3 + 1};
+
+	AccelerationAndDecelerationAndGroundFrictionTable.Reserve(SamplesCount * 3);
+
+	for (auto i{0}; i < SamplesCount; i++)
+	{
+		const auto GaitAmount{static_cast<float>(i) / AccelerationAndDecelerationAndGroundFrictionTableResolution};
+
+		AccelerationAndDecelerationAndGroundFrictionTable.Add(
+			AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[0].Eval(GaitAmount));
+
+		AccelerationAndDecelerationAndGroundFrictionTable.Add(
+			AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[1].Eval(GaitAmount));
+
+		AccelerationAndDecelerationAndGroundFrictionTable.Add(
+			AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves[2].Eval(GaitAmount));
+	}
+}
+
+FVector3f FAlsMovementGaitSettings::EvaluateAccelerationAndDecelerationAndGroundFrictionCurve(const float GaitAmount) const
+{
+	// The table is out of date, for example because the curve was assigned at runtime, so the curve is evaluated directly.
+
+	if (!ALS_ENSURE(IsValid(AccelerationAndDecelerationAndGroundFrictionCurve)))
+	{
+		return FVector3f::ZeroVector;
+	}
+
+	return FVector3f{AccelerationAndDecelerationAndGroundFrictionCurve->GetVectorValue(GaitAmount)};
+}
+
+void UAlsMovementSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	RefreshAccelerationAndDecelerationAndGroundFrictionTables();
+}
+
+void UAlsMovementSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	RefreshAccelerationAndDecelerationAndGroundFrictionTables();
+}
+
+#if WITH_EDITOR
+void UAlsMovementSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	RefreshAccelerationAndDecelerationAndGroundFrictionTables();
+
+	// Character movement components keep copies of the gait settings, so they must be refreshed after the tables are rebuilt.
+
+	for (TObjectIterator<UAlsCharacterMovementComponent> Iterator; Iterator; ++Iterator)
+	{
+		if (Iterator->GetMovementSettings() == this)
+		{
+			Iterator->SetMovementSettings(this);
+		}
+	}
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UAlsMovementSettings::RefreshAccelerationAndDecelerationAndGroundFrictionTables()
+{
+	for (auto& RotationModeTuple : RotationModes)
+	{
+		for (auto& StanceTuple : RotationModeTuple.Value.Stances)
+		{
+			StanceTuple.Value.RefreshAccelerationAndDecelerationAndGroundFrictionTable();
+		}
+	}
+}
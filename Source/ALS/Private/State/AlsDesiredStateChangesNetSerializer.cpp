@@ -0,0 +1,380 @@
+#include "State/AlsDesiredStateChanges.h"
+
+#if UE_WITH_IRIS
+
+#include "GameplayTagNetSerializer.h"
+#include "Iris/ReplicationState/PropertyNetSerializerInfoRegistry.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializationContext.h"
+#include "Iris/Serialization/NetSerializer.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+
+namespace UE::Net
+{
+	// Native Iris counterpart of FAlsDesiredStateChanges::NetSerialize(). Only the values whose flags are set are
+	// written to the bit stream. Gameplay tags are delegated to the engine's gameplay tag serializer, so they are
+	// replicated the same way as everywhere else, whether or not fast replication is enabled.
+	struct FAlsDesiredStateChangesNetSerializer
+	{
+		static constexpr auto TagsCount{5};
+
+		// Storage for the quantized state of a single gameplay tag. Its actual size
+		// is owned by the gameplay tag serializer and is checked on registration.
+		struct alignas(8) FQuantizedTag
+		{
+			uint8 Data[16];
+		};
+
+		struct FQuantizedType
+		{
+			uint8 Flags;
+			uint8 bDesiredAiming;
+			FQuantizedTag Tags[TagsCount];
+		};
+
+		static constexpr uint32 Version{1};
+
+		static constexpr bool bHasDynamicState{true};
+
+		using SourceType = FAlsDesiredStateChanges;
+		using QuantizedType = FQuantizedType;
+		using ConfigType = FNetSerializerConfig;
+
+		static const ConfigType DefaultConfig;
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+
+		static void CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args);
+
+		static void FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args);
+
+	private:
+		class FNetSerializerRegistryDelegates final : private UE::Net::FNetSerializerRegistryDelegates
+		{
+		public:
+			virtual ~FNetSerializerRegistryDelegates() override;
+
+		private:
+			virtual void OnPreFreezeNetSerializerRegistry() override;
+		};
+
+		static FNetSerializerRegistryDelegates NetSerializerRegistryDelegates;
+	};
+
+	namespace AlsDesiredStateChangesNetSerializer
+	{
+		static constexpr auto FlagsBitsCount{6};
+
+		static constexpr EAlsDesiredStateFlags TagFlags[FAlsDesiredStateChangesNetSerializer::TagsCount]
+		{
+			EAlsDesiredStateFlags::DesiredRotationMode,
+			EAlsDesiredStateFlags::DesiredStance,
+			EAlsDesiredStateFlags::DesiredGait,
+			EAlsDesiredStateFlags::ViewMode,
+			EAlsDesiredStateFlags::OverlayMode
+		};
+
+		static constexpr FGameplayTag FAlsDesiredStateChanges::* Tags[FAlsDesiredStateChangesNetSerializer::TagsCount]
+		{
+			&FAlsDesiredStateChanges::DesiredRotationMode,
+			&FAlsDesiredStateChanges::DesiredStance,
+			&FAlsDesiredStateChanges::DesiredGait,
+			&FAlsDesiredStateChanges::ViewMode,
+			&FAlsDesiredStateChanges::OverlayMode
+		};
+
+		const FNetSerializer& GetTagSerializer()
+		{
+			return UE_NET_GET_SERIALIZER(FGameplayTagNetSerializer);
+		}
+	}
+
+	static const FName PropertyNetSerializerRegistry_NAME_AlsDesiredStateChanges{TEXT("AlsDesiredStateChanges")};
+
+	UE_NET_DECLARE_SERIALIZER(FAlsDesiredStateChangesNetSerializer, ALS_API);
+	UE_NET_IMPLEMENT_SERIALIZER(FAlsDesiredStateChangesNetSerializer);
+
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsDesiredStateChanges, FAlsDesiredStateChangesNetSerializer);
+
+	const FAlsDesiredStateChangesNetSerializer::ConfigType FAlsDesiredStateChangesNetSerializer::DefaultConfig;
+
+	FAlsDesiredStateChangesNetSerializer::FNetSerializerRegistryDelegates FAlsDesiredStateChangesNetSerializer::NetSerializerRegistryDelegates;
+
+	void FAlsDesiredStateChangesNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+	{
+		const auto& Value{*reinterpret_cast<const QuantizedType*>(Args.Source)};
+		auto* Writer{Context.GetBitStreamWriter()};
+
+		Writer->WriteBits(Value.Flags, AlsDesiredStateChangesNetSerializer::FlagsBitsCount);
+
+		const auto Flags{static_cast<EAlsDesiredStateFlags>(Value.Flags)};
+
+		if (EnumHasAnyFlags(Flags, EAlsDesiredStateFlags::DesiredAiming))
+		{
+			Writer->WriteBits(Value.bDesiredAiming, 1);
+		}
+
+		const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+
+		FNetSerializeArgs TagArgs{Args};
+		TagArgs.NetSerializerConfig = TagSerializer.DefaultConfig;
+
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			if (EnumHasAnyFlags(Flags, AlsDesiredStateChangesNetSerializer::TagFlags[i]))
+			{
+				TagArgs.Source = reinterpret_cast<NetSerializerValuePointer>(&Value.Tags[i]);
+				TagSerializer.Serialize(Context, TagArgs);
+			}
+		}
+	}
+
+	void FAlsDesiredStateChangesNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+	{
+		auto& Value{*reinterpret_cast<QuantizedType*>(Args.Target)};
+		auto* Reader{Context.GetBitStreamReader()};
+
+		Value.Flags = static_cast<uint8>(Reader->ReadBits(AlsDesiredStateChangesNetSerializer::FlagsBitsCount));
+		Value.bDesiredAiming = 0;
+
+		const auto Flags{static_cast<EAlsDesiredStateFlags>(Value.Flags)};
+
+		if (EnumHasAnyFlags(Flags, EAlsDesiredStateFlags::DesiredAiming))
+		{
+			Value.bDesiredAiming = static_cast<uint8>(Reader->ReadBits(1));
+		}
+
+		const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+
+		FNetDeserializeArgs TagArgs{Args};
+		TagArgs.NetSerializerConfig = TagSerializer.DefaultConfig;
+
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			if (EnumHasAnyFlags(Flags, AlsDesiredStateChangesNetSerializer::TagFlags[i]))
+			{
+				TagArgs.Target = reinterpret_cast<NetSerializerValuePointer>(&Value.Tags[i]);
+				TagSerializer.Deserialize(Context, TagArgs);
+			}
+			else
+			{
+				Value.Tags[i] = {};
+			}
+		}
+	}
+
+	void FAlsDesiredStateChangesNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const SourceType*>(Args.Source)};
+		auto& Target{*reinterpret_cast<QuantizedType*>(Args.Target)};
+
+		Target.Flags = static_cast<uint8>(Source.Flags & EAlsDesiredStateFlags::All);
+		Target.bDesiredAiming = Source.bDesiredAiming ? 1 : 0;
+
+		const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+
+		FNetQuantizeArgs TagArgs{Args};
+		TagArgs.NetSerializerConfig = TagSerializer.DefaultConfig;
+
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			if (EnumHasAnyFlags(Source.Flags, AlsDesiredStateChangesNetSerializer::TagFlags[i]))
+			{
+				TagArgs.Source = reinterpret_cast<NetSerializerValuePointer>(&(Source.*AlsDesiredStateChangesNetSerializer::Tags[i]));
+				TagArgs.Target = reinterpret_cast<NetSerializerValuePointer>(&Target.Tags[i]);
+				TagSerializer.Quantize(Context, TagArgs);
+			}
+			else
+			{
+				Target.Tags[i] = {};
+			}
+		}
+	}
+
+	void FAlsDesiredStateChangesNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const QuantizedType*>(Args.Source)};
+		auto& Target{*reinterpret_cast<SourceType*>(Args.Target)};
+
+		Target.Flags = static_cast<EAlsDesiredStateFlags>(Source.Flags) & EAlsDesiredStateFlags::All;
+		Target.bDesiredAiming = Source.bDesiredAiming != 0;
+
+		const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+
+		FNetDequantizeArgs TagArgs{Args};
+		TagArgs.NetSerializerConfig = TagSerializer.DefaultConfig;
+
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			auto& Tag{Target.*AlsDesiredStateChangesNetSerializer::Tags[i]};
+
+			if (EnumHasAnyFlags(Target.Flags, AlsDesiredStateChangesNetSerializer::TagFlags[i]))
+			{
+				TagArgs.Source = reinterpret_cast<NetSerializerValuePointer>(&Source.Tags[i]);
+				TagArgs.Target = reinterpret_cast<NetSerializerValuePointer>(&Tag);
+				TagSerializer.Dequantize(Context, TagArgs);
+			}
+			else
+			{
+				Tag = FGameplayTag::EmptyTag;
+			}
+		}
+	}
+
+	bool FAlsDesiredStateChangesNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+	{
+		if (Args.bStateIsQuantized)
+		{
+			const auto& Value0{*reinterpret_cast<const QuantizedType*>(Args.Source0)};
+			const auto& Value1{*reinterpret_cast<const QuantizedType*>(Args.Source1)};
+
+			if (Value0.Flags != Value1.Flags || Value0.bDesiredAiming != Value1.bDesiredAiming)
+			{
+				return false;
+			}
+
+			const auto Flags{static_cast<EAlsDesiredStateFlags>(Value0.Flags)};
+			const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+
+			FNetIsEqualArgs TagArgs{Args};
+			TagArgs.NetSerializerConfig = TagSerializer.DefaultConfig;
+
+			for (auto i{0}; i < TagsCount; i++)
+			{
+				if (EnumHasAnyFlags(Flags, AlsDesiredStateChangesNetSerializer::TagFlags[i]))
+				{
+					TagArgs.Source0 = reinterpret_cast<NetSerializerValuePointer>(&Value0.Tags[i]);
+					TagArgs.Source1 = reinterpret_cast<NetSerializerValuePointer>(&Value1.Tags[i]);
+
+					if (!TagSerializer.IsEqual(Context, TagArgs))
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		const auto& Value0{*reinterpret_cast<const SourceType*>(Args.Source0)};
+		const auto& Value1{*reinterpret_cast<const SourceType*>(Args.Source1)};
+
+		return Value0.Flags == Value1.Flags &&
+		       Value0.bDesiredAiming == Value1.bDesiredAiming &&
+		       Value0.DesiredRotationMode == Value1.DesiredRotationMode &&
+		       Value0.DesiredStance == Value1.DesiredStance &&
+		       Value0.DesiredGait == Value1.DesiredGait &&
+		       Value0.ViewMode == Value1.ViewMode &&
+		       Value0.OverlayMode == Value1.OverlayMode;
+	}
+
+	bool FAlsDesiredStateChangesNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+	{
+		const auto& Source{*reinterpret_cast<const SourceType*>(Args.Source)};
+
+		if (EnumHasAnyFlags(Source.Flags, ~EAlsDesiredStateFlags::All))
+		{
+			return false;
+		}
+
+		const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+
+		FNetValidateArgs TagArgs{Args};
+		TagArgs.NetSerializerConfig = TagSerializer.DefaultConfig;
+
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			if (EnumHasAnyFlags(Source.Flags, AlsDesiredStateChangesNetSerializer::TagFlags[i]))
+			{
+				TagArgs.Source = reinterpret_cast<NetSerializerValuePointer>(&(Source.*AlsDesiredStateChangesNetSerializer::Tags[i]));
+
+				if (!TagSerializer.Validate(Context, TagArgs))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void FAlsDesiredStateChangesNetSerializer::CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args)
+	{
+		const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+		if (!EnumHasAnyFlags(TagSerializer.Traits, ENetSerializerTraits::HasDynamicState))
+		{
+			return;
+		}
+
+		const auto& Source{*reinterpret_cast<const QuantizedType*>(Args.Source)};
+		auto& Target{*reinterpret_cast<QuantizedType*>(Args.Target)};
+
+		const auto Flags{static_cast<EAlsDesiredStateFlags>(Source.Flags)};
+
+		FNetCloneDynamicStateArgs TagArgs{Args};
+		TagArgs.NetSerializerConfig = TagSerializer.DefaultConfig;
+
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			if (EnumHasAnyFlags(Flags, AlsDesiredStateChangesNetSerializer::TagFlags[i]))
+			{
+				TagArgs.Source = reinterpret_cast<NetSerializerValuePointer>(&Source.Tags[i]);
+				TagArgs.Target = reinterpret_cast<NetSerializerValuePointer>(&Target.Tags[i]);
+				TagSerializer.CloneDynamicState(Context, TagArgs);
+			}
+		}
+	}
+
+	void FAlsDesiredStateChangesNetSerializer::FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args)
+	{
+		const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+		if (!EnumHasAnyFlags(TagSerializer.Traits, ENetSerializerTraits::HasDynamicState))
+		{
+			return;
+		}
+
+		auto& Value{*reinterpret_cast<QuantizedType*>(Args.Source)};
+
+		const auto Flags{static_cast<EAlsDesiredStateFlags>(Value.Flags)};
+
+		FNetFreeDynamicStateArgs TagArgs{Args};
+		TagArgs.NetSerializerConfig = TagSerializer.DefaultConfig;
+
+		for (auto i{0}; i < TagsCount; i++)
+		{
+			if (EnumHasAnyFlags(Flags, AlsDesiredStateChangesNetSerializer::TagFlags[i]))
+			{
+				TagArgs.Source = reinterpret_cast<NetSerializerValuePointer>(&Value.Tags[i]);
+				TagSerializer.FreeDynamicState(Context, TagArgs);
+			}
+		}
+	}
+
+	FAlsDesiredStateChangesNetSerializer::FNetSerializerRegistryDelegates::~FNetSerializerRegistryDelegates()
+	{
+		UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsDesiredStateChanges);
+	}
+
+	void FAlsDesiredStateChangesNetSerializer::FNetSerializerRegistryDelegates::OnPreFreezeNetSerializerRegistry()
+	{
+		const auto& TagSerializer{AlsDesiredStateChangesNetSerializer::GetTagSerializer()};
+
+		checkf(TagSerializer.QuantizedTypeSize <= sizeof(FQuantizedTag) && TagSerializer.QuantizedTypeAlignment <= alignof(FQuantizedTag),
+		       TEXT("The quantized gameplay tag storage is too small for %s."), TagSerializer.Name);
+
+		UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_AlsDesiredStateChanges);
+	}
+}
+
+#endif
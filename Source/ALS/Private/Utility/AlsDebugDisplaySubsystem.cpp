@@ -0,0 +1,82 @@
+#include "Utility/AlsDebugDisplaySubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/HUD.h"
+#include "GameFramework/PlayerController.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsDebugDisplaySubsystem)
+
+void UAlsDebugDisplaySubsystem::Deinitialize()
+{
+	DisplayNames.Reset();
+	Hud.Reset();
+	DebugTargetActor.Reset();
+	DisplayNamesMask = 0;
+	CacheFrame = 0;
+
+	Super::Deinitialize();
+}
+
+bool UAlsDebugDisplaySubsystem::ShouldDisplayDebugForActor(const AActor* Actor, const FName& DisplayName)
+{
+	check(IsInGameThread())
+
+	if (CacheFrame != GFrameCounter)
+	{
+		RefreshCache();
+	}
+
+	if (!IsValid(Actor) || DebugTargetActor.Get() != Actor)
+	{
+		return false;
+	}
+
+	auto DisplayNameIndex{DisplayNames.Find(DisplayName)};
+	if (DisplayNameIndex == INDEX_NONE)
+	{
+		if (DisplayNames.Num() >= MaxDisplayNamesCount)
+		{
+			// The bit mask is full, so this display name is not cached.
+
+			return Hud.IsValid() && Hud->ShouldDisplayDebug(DisplayName);
+		}
+
+		DisplayNameIndex = DisplayNames.Add(DisplayName);
+
+		if (Hud.IsValid() && Hud->ShouldDisplayDebug(DisplayName))
+		{
+			DisplayNamesMask |= 1ull << DisplayNameIndex;
+		}
+	}
+
+	return (DisplayNamesMask & 1ull << DisplayNameIndex) != 0;
+}
+
+void UAlsDebugDisplaySubsystem::RefreshCache()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsDebugDisplaySubsystem::RefreshCache()"),
+	                            STAT_UAlsDebugDisplaySubsystem_RefreshCache, STATGROUP_Als)
+
+	CacheFrame = GFrameCounter;
+	DisplayNamesMask = 0;
+
+	const auto* PlayerController{GetWorld()->GetFirstPlayerController()};
+	auto* NewHud{IsValid(PlayerController) ? PlayerController->GetHUD() : nullptr};
+
+	Hud = NewHud;
+	DebugTargetActor = IsValid(NewHud) ? NewHud->GetCurrentDebugTargetActor() : nullptr;
+
+	if (!DebugTargetActor.IsValid())
+	{
+		return;
+	}
+
+	for (auto i{0}; i < DisplayNames.Num(); i++)
+	{
+		if (NewHud->ShouldDisplayDebug(DisplayNames[i]))
+		{
+			DisplayNamesMask |= 1ull << i;
+		}
+	}
+}
@@ -0,0 +1,321 @@
+#include "Utility/AlsDebugDrawSubsystem.h"
+
+#include "DrawDebugHelpers.h"
+#include "Engine/HitResult.h"
+#include "Engine/World.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsDebugDrawSubsystem)
+
+bool UAlsDebugDrawSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if ENABLE_DRAW_DEBUG
+	return Super::ShouldCreateSubsystem(Outer);
+#else
+	return false;
+#endif
+}
+
+void UAlsDebugDrawSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	MaxCommands = FMath::Max(1, MaxCommands);
+
+	Commands.SetNum(MaxCommands);
+	DrawnCommands.Reserve(MaxCommands);
+}
+
+void UAlsDebugDrawSubsystem::Deinitialize()
+{
+	{
+		FScopeLock Lock{&CommandsLock};
+
+		Commands.Empty();
+		FirstCommandIndex = 0;
+		CommandsCount = 0;
+	}
+
+	DrawnCommands.Empty();
+
+	Super::Deinitialize();
+}
+
+void UAlsDebugDrawSubsystem::Tick(const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsDebugDrawSubsystem::Tick()"), STAT_UAlsDebugDrawSubsystem_Tick, STATGROUP_Als)
+
+	Super::Tick(DeltaTime);
+
+	{
+		// Commands are copied out of the ring buffer, so the lock is not held while drawing them.
+
+		FScopeLock Lock{&CommandsLock};
+
+		DrawnCommands.Reset();
+
+		for (auto i{0}; i < CommandsCount; i++)
+		{
+			DrawnCommands.Add(Commands[(FirstCommandIndex + i) % Commands.Num()]);
+		}
+
+		FirstCommandIndex = 0;
+		CommandsCount = 0;
+	}
+
+	for (const auto& Command : DrawnCommands)
+	{
+		DrawCommand(Command);
+	}
+
+	DrawnCommands.Reset();
+}
+
+TStatId UAlsDebugDrawSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAlsDebugDrawSubsystem, STATGROUP_Als)
+}
+
+void UAlsDebugDrawSubsystem::QueueLine(const FVector& Start, const FVector& End, const FLinearColor& Color,
+                                       const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::Line;
+	Command.Start = Start;
+	Command.End = End;
+	Command.Color = Color;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueLineTraceSingle(const FVector& Start, const FVector& End, const bool bHit, const FHitResult& Hit,
+                                                  const FLinearColor& TraceColor, const FLinearColor& HitColor,
+                                                  const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::LineTraceSingle;
+	Command.bHit = bHit && Hit.bBlockingHit;
+	Command.Start = Start;
+	Command.End = End;
+	Command.HitImpactPoint = Hit.ImpactPoint;
+	Command.Color = TraceColor;
+	Command.HitColor = HitColor;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueSweepSphere(const FVector& Start, const FVector& End, const float Radius,
+                                              const FLinearColor& Color, const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::SweepSphere;
+	Command.Start = Start;
+	Command.End = End;
+	Command.Radius = Radius;
+	Command.Color = Color;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueSweepSingleSphere(const FVector& Start, const FVector& End, const float Radius, const bool bHit,
+                                                    const FHitResult& Hit, const FLinearColor& SweepColor, const FLinearColor& HitColor,
+                                                    const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::SweepSingleSphere;
+	Command.bHit = bHit && Hit.bBlockingHit;
+	Command.Start = Start;
+	Command.End = End;
+	Command.HitLocation = Hit.Location;
+	Command.HitImpactPoint = Hit.ImpactPoint;
+	Command.Radius = Radius;
+	Command.Color = SweepColor;
+	Command.HitColor = HitColor;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueSweepSingleCapsule(const FVector& Start, const FVector& End, const FQuat& Rotation,
+                                                     const float Radius, const float HalfHeight, const bool bHit, const FHitResult& Hit,
+                                                     const FLinearColor& SweepColor, const FLinearColor& HitColor,
+                                                     const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::SweepSingleCapsule;
+	Command.bHit = bHit && Hit.bBlockingHit;
+	Command.Start = Start;
+	Command.End = End;
+	Command.Rotation = Rotation;
+	Command.HitLocation = Hit.Location;
+	Command.HitImpactPoint = Hit.ImpactPoint;
+	Command.Radius = Radius;
+	Command.HalfHeight = HalfHeight;
+	Command.Color = SweepColor;
+	Command.HitColor = HitColor;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueSweepSingleCapsuleAlternative(const FVector& Start, const FVector& End, const float Radius,
+                                                                const float HalfHeight, const bool bHit, const FHitResult& Hit,
+                                                                const FLinearColor& SweepColor, const FLinearColor& HitColor,
+                                                                const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::SweepSingleCapsuleAlternative;
+	Command.bHit = bHit && Hit.bBlockingHit;
+	Command.Start = Start;
+	Command.End = End;
+	Command.HitLocation = Hit.Location;
+	Command.HitImpactPoint = Hit.ImpactPoint;
+	Command.Radius = Radius;
+	Command.HalfHeight = HalfHeight;
+	Command.Color = SweepColor;
+	Command.HitColor = HitColor;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueSphere(const FVector& Location, const FQuat& Rotation, const float Radius,
+                                         const FLinearColor& Color, const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::Sphere;
+	Command.Start = Location;
+	Command.Rotation = Rotation;
+	Command.Radius = Radius;
+	Command.Color = Color;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueCapsule(const FVector& Location, const FQuat& Rotation, const float Radius,
+                                          const float HalfHeight, const FLinearColor& Color,
+                                          const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::Capsule;
+	Command.Start = Location;
+	Command.Rotation = Rotation;
+	Command.Radius = Radius;
+	Command.HalfHeight = HalfHeight;
+	Command.Color = Color;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueCoordinateSystem(const FVector& Location, const FQuat& Rotation, const float Scale,
+                                                   const float Duration, const float Thickness)
+{
+	FAlsDebugDrawCommand Command;
+	Command.Type = EAlsDebugDrawCommandType::CoordinateSystem;
+	Command.Start = Location;
+	Command.Rotation = Rotation;
+	Command.Radius = Scale;
+	Command.Duration = Duration;
+	Command.Thickness = Thickness;
+
+	QueueCommand(Command);
+}
+
+void UAlsDebugDrawSubsystem::QueueCommand(const FAlsDebugDrawCommand& Command)
+{
+#if ENABLE_DRAW_DEBUG
+	FScopeLock Lock{&CommandsLock};
+
+	if (Commands.IsEmpty())
+	{
+		return;
+	}
+
+	if (CommandsCount < Commands.Num())
+	{
+		Commands[(FirstCommandIndex + CommandsCount) % Commands.Num()] = Command;
+		CommandsCount += 1;
+	}
+	else
+	{
+		// Overwrite the oldest command.
+
+		Commands[FirstCommandIndex] = Command;
+		FirstCommandIndex = (FirstCommandIndex + 1) % Commands.Num();
+		OverwrittenCommandsCount += 1;
+	}
+#endif
+}
+
+void UAlsDebugDrawSubsystem::DrawCommand(const FAlsDebugDrawCommand& Command) const
+{
+#if ENABLE_DRAW_DEBUG
+	FHitResult Hit;
+	Hit.bBlockingHit = Command.bHit;
+	Hit.Location = Command.HitLocation;
+	Hit.ImpactPoint = Command.HitImpactPoint;
+
+	switch (Command.Type)
+	{
+		case EAlsDebugDrawCommandType::Line:
+			DrawDebugLine(GetWorld(), Command.Start, Command.End, Command.Color.ToFColor(true),
+			              Command.Duration < 0.0f, Command.Duration, 0, Command.Thickness);
+			break;
+
+		case EAlsDebugDrawCommandType::LineTraceSingle:
+			UAlsUtility::DrawDebugLineTraceSingle(GetWorld(), Command.Start, Command.End, Command.bHit, Hit,
+			                                      Command.Color, Command.HitColor, Command.Duration, Command.Thickness);
+			break;
+
+		case EAlsDebugDrawCommandType::SweepSphere:
+			UAlsUtility::DrawDebugSweepSphere(GetWorld(), Command.Start, Command.End, Command.Radius,
+			                                  Command.Color, Command.Duration, Command.Thickness);
+			break;
+
+		case EAlsDebugDrawCommandType::SweepSingleSphere:
+			UAlsUtility::DrawDebugSweepSingleSphere(GetWorld(), Command.Start, Command.End, Command.Radius, Command.bHit, Hit,
+			                                        Command.Color, Command.HitColor, Command.Duration, Command.Thickness);
+			break;
+
+		case EAlsDebugDrawCommandType::SweepSingleCapsule:
+			UAlsUtility::DrawDebugSweepSingleCapsule(GetWorld(), Command.Start, Command.End, Command.Rotation.Rotator(),
+			                                         Command.Radius, Command.HalfHeight, Command.bHit, Hit,
+			                                         Command.Color, Command.HitColor, Command.Duration, Command.Thickness);
+			break;
+
+		case EAlsDebugDrawCommandType::SweepSingleCapsuleAlternative:
+			UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), Command.Start, Command.End, Command.Radius,
+			                                                    Command.HalfHeight, Command.bHit, Hit, Command.Color,
+			                                                    Command.HitColor, Command.Duration, Command.Thickness);
+			break;
+
+		case EAlsDebugDrawCommandType::Sphere:
+			UAlsUtility::DrawDebugSphereAlternative(GetWorld(), Command.Start, Command.Rotation.Rotator(), Command.Radius,
+			                                        Command.Color, Command.Duration, Command.Thickness);
+			break;
+
+		case EAlsDebugDrawCommandType::Capsule:
+			DrawDebugCapsule(GetWorld(), Command.Start, Command.HalfHeight, Command.Radius, Command.Rotation,
+			                 Command.Color.ToFColor(true), Command.Duration < 0.0f, Command.Duration, 0, Command.Thickness);
+			break;
+
+		case EAlsDebugDrawCommandType::CoordinateSystem:
+			DrawDebugCoordinateSystem(GetWorld(), Command.Start, Command.Rotation.Rotator(), Command.Radius,
+			                          Command.Duration < 0.0f, Command.Duration, 0, Command.Thickness);
+			break;
+	}
+#endif
+}
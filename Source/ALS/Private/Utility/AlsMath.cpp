@@ -87,3 +87,29 @@ bool UAlsMath::TryCalculatePoleVector(const FVector& ALocation, const FVector& B
 
 	return Direction.Normalize(); // Direction will be zero and cannot be normalized if A, B and C are collinear.
 }
+
+void UAlsMath::TransformLocationsAndRotations(const FTransform& Transform, const TConstArrayView<FVector> Locations,
+                                              const TConstArrayView<FQuat> Rotations, const TArrayView<FVector> TransformedLocations,
+                                              const TArrayView<FQuat> TransformedRotations)
+{
+	check(Locations.Num() == Rotations.Num() && Locations.Num() == TransformedLocations.Num() &&
+	      Locations.Num() == TransformedRotations.Num())
+
+	const auto Rotation{Transform.GetRotation()};
+	const auto Translation{Transform.GetTranslation()};
+	const auto Scale{Transform.GetScale3D()};
+
+	const auto RotationRegister{VectorLoad(&Rotation.X)};
+	const auto TranslationRegister{VectorLoadFloat3_W0(&Translation.X)};
+	const auto ScaleRegister{VectorLoadFloat3_W0(&Scale.X)};
+
+	for (auto i{0}; i < Locations.Num(); i++)
+	{
+		const auto LocationRegister{VectorMultiply(ScaleRegister, VectorLoadFloat3_W0(&Locations[i].X))};
+
+		VectorStoreFloat3(VectorAdd(VectorQuaternionRotateVector(RotationRegister, LocationRegister), TranslationRegister),
+		                  &TransformedLocations[i].X);
+
+		VectorStore(VectorQuaternionMultiply2(RotationRegister, VectorLoad(&Rotations[i].X)), &TransformedRotations[i].X);
+	}
+}
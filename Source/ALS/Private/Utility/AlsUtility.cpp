@@ -11,6 +11,7 @@
 #include "GameFramework/HUD.h"
 #include "GameFramework/PlayerState.h"
 #include "Kismet/GameplayStatics.h"
+#include "Utility/AlsDebugDisplaySubsystem.h"
 #include "Utility/AlsMacros.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsUtility)
@@ -126,6 +127,13 @@ FTransform UAlsUtility::ExtractLastRootTransformFromMontage(const UAnimMontage*
 bool UAlsUtility::ShouldDisplayDebugForActor(const AActor* Actor, const FName& DisplayName)
 {
 	const auto* World{IsValid(Actor) ? Actor->GetWorld() : nullptr};
+
+	auto* DebugDisplaySubsystem{IsValid(World) && IsInGameThread() ? World->GetSubsystem<UAlsDebugDisplaySubsystem>() : nullptr};
+	if (IsValid(DebugDisplaySubsystem))
+	{
+		return DebugDisplaySubsystem->ShouldDisplayDebugForActor(Actor, DisplayName);
+	}
+
 	const auto* PlayerController{IsValid(World) ? World->GetFirstPlayerController() : nullptr};
 	auto* Hud{IsValid(PlayerController) ? PlayerController->GetHUD() : nullptr};
 
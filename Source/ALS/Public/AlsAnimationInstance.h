@@ -4,7 +4,9 @@
 #include "Engine/World.h"
 #include "State/AlsControlRigInput.h"
 #include "State/AlsFeetState.h"
+#include "State/AlsFrozenPoseState.h"
 #include "State/AlsGroundedState.h"
+#include "State/AlsIdleState.h"
 #include "State/AlsInAirState.h"
 #include "State/AlsLayeringState.h"
 #include "State/AlsLeanState.h"
@@ -21,6 +23,7 @@
 
 struct FAlsFootLimitsSettings;
 class UAlsLinkedAnimationInstance;
+class UAlsDebugDrawSubsystem;
 class AAlsCharacter;
 
 UCLASS()
@@ -46,11 +49,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ClampMin = 0))
 	float TeleportedTime;
 
+	// Incremented every time the thread-safe state update is performed, so that linked animation instances can tell
+	// whether the state has been updated since their previous update. Updates skipped by the idle update rate reduction
+	// do not increment it. It does not tell whether any state value has actually changed.
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	uint32 UpdateRevision{1};
+
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	bool bDisplayDebugTraces;
 
-	mutable TArray<TFunction<void()>> DisplayDebugTracesQueue;
+	// Debug traces made on worker threads are queued into this subsystem and drawn later on the game thread.
+	TObjectPtr<UAlsDebugDrawSubsystem> DebugDrawSubsystem;
 #endif
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
@@ -116,6 +126,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsRagdollingAnimationState RagdollingState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsIdleState IdleState;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsFrozenPoseState FrozenPoseState;
+
 public:
 	virtual void NativeInitializeAnimation() override;
 
@@ -149,6 +165,20 @@ public:
 private:
 	void RefreshMovementBaseOnGameThread();
 
+	void RefreshIdleOnGameThread(float DeltaTime, bool bStateChanged);
+
+	bool IsFullyIdle() const;
+
+	void WakeFromIdle();
+
+public:
+	bool ShouldFreezePose() const;
+
+	void FreezePose();
+
+private:
+	void RefreshFrozenPoseOnGameThread(float DeltaTime);
+
 	void RefreshLayering();
 
 	void RefreshPose();
@@ -242,13 +272,16 @@ public:
 	// complete shutdown because the internal state of the foot locking will continue to update.
 	virtual bool IsFootLockInhibited() const;
 
+	const FAlsFeetState& GetFeetState() const;
+
 private:
 	void RefreshFeetOnGameThread();
 
 	void RefreshFeet(float DeltaTime);
 
 	void RefreshFoot(FAlsFootState& FootState, const FName& FootIkCurveName, const FName& FootLockCurveName,
-	                 const FAlsFootLimitsSettings& LimitsSettings, const FTransform& ComponentTransformInverse, float DeltaTime) const;
+	                 const FAlsFootLimitsSettings& LimitsSettings, const FTransform& ComponentTransformInverse,
+	                 float DeltaTime, FVector& FinalLocation, FQuat& FinalRotation) const;
 
 	void ProcessFootLockTeleport(FAlsFootState& FootState) const;
 
@@ -283,6 +316,8 @@ public:
 	void StopTransitionAndTurnInPlaceAnimations(float BlendOutDuration = 0.2f);
 
 private:
+	void ResetTransitionsAndInPlaceRotations();
+
 	void RefreshTransitions();
 
 	void RefreshDynamicTransition();
@@ -331,11 +366,27 @@ inline UAlsAnimationInstanceSettings* UAlsAnimationInstance::GetSettingsUnsafe()
 inline void UAlsAnimationInstance::MarkPendingUpdate()
 {
 	bPendingUpdate |= true;
+
+	WakeFromIdle();
 }
 
 inline void UAlsAnimationInstance::MarkTeleported()
 {
 	TeleportedTime = GetWorld()->GetTimeSeconds();
+
+	WakeFromIdle();
+}
+
+inline void UAlsAnimationInstance::WakeFromIdle()
+{
+	IdleState.bIdle = false;
+	IdleState.IdleTime = 0.0f;
+	IdleState.SkippedFramesCount = 0;
+}
+
+inline const FAlsFeetState& UAlsAnimationInstance::GetFeetState() const
+{
+	return FeetState;
 }
 
 inline void UAlsAnimationInstance::SetGroundedEntryMode(const FGameplayTag& NewGroundedEntryMode)
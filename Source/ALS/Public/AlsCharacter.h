@@ -3,6 +3,7 @@
 #include "GameFramework/Character.h"
 #include "Net/Core/PushModel/PushModel.h"
 #include "Settings/AlsMantlingSettings.h"
+#include "State/AlsDesiredStateChanges.h"
 #include "State/AlsLocomotionState.h"
 #include "State/AlsMantlingState.h"
 #include "State/AlsMovementBaseState.h"
@@ -279,7 +280,7 @@ private:
 	UFUNCTION(NetMulticast, Reliable)
 	void MulticastOnJumpedNetworked();
 	UFUNCTION(Server, Unreliable)
-	void ServerSetReplicatedViewRotation(const FRotator& NewViewRotation);
+	void ServerSetReplicatedViewRotation(uint16 CompressedPitch, uint16 CompressedYaw);
 	UFUNCTION(Client, Reliable)
 	void ClientSetDesiredGait(const FGameplayTag& NewDesiredGait);
 	UFUNCTION(Server, Reliable)
@@ -304,6 +305,10 @@ private:
 	void ClientSetDesiredStance(const FGameplayTag& NewDesiredStance);
 	UFUNCTION(Server, Reliable)
 	void ServerSetDesiredStance(const FGameplayTag& NewDesiredStance);
+	UFUNCTION(Client, Reliable)
+	void ClientSetDesiredState(const FAlsDesiredStateChanges& Changes);
+	UFUNCTION(Server, Reliable)
+	void ServerSetDesiredState(const FAlsDesiredStateChanges& Changes);
 	
 	//////////////////////////////////
 	/// Private OnReplicated
@@ -326,6 +331,22 @@ private:
 	void SetOverlayMode(const FGameplayTag& NewOverlayMode, bool bSendRpc);
 	void SetReplicatedViewRotation(const FRotator& NewViewRotation, bool bSendRpc);
 
+	//////////////////////////////////
+	/// Private Desired State Coalescing
+	//////////////////////////////////
+	// Returns true if the desired state change should be sent later as part of the coalesced RPC.
+	bool QueueDesiredStateRpc(EAlsDesiredStateFlags Flag);
+	void SendDesiredStateRpc();
+	void ApplyDesiredStateChanges(const FAlsDesiredStateChanges& Changes);
+
+	// Desired state changes made during the current frame that have not yet been sent.
+	EAlsDesiredStateFlags PendingDesiredStateFlags{EAlsDesiredStateFlags::None};
+
+	// Last view rotation sent to the server or marked for replication, quantized to 16 bits per axis without roll.
+	FRotator NetViewRotation{ForceInit};
+
+	double NetViewRotationSendTime{0.0};
+
 protected:
 	//////////////////////////////////
 	/// Protected Replicated Vars
@@ -436,6 +457,7 @@ public:
 	FORCEINLINE const FVector& GetInputDirection() const { return InputDirection; }
 	FORCEINLINE const FAlsViewState& GetViewState() const { return ViewState; }
 	FORCEINLINE const FAlsLocomotionState& GetLocomotionState() const { return LocomotionState; }
+	FORCEINLINE UAlsCharacterMovementComponent* GetAlsCharacterMovement() const { return AlsCharacterMovement; }
 	FORCEINLINE bool IsDesiredAiming() const { return bDesiredAiming; }
 #pragma endregion PublicInline
 };
\ No newline at end of file
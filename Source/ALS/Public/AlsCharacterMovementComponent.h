@@ -2,6 +2,7 @@
 
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/AlsMovementSettings.h"
+#include "State/AlsDerivedMovementState.h"
 #include "AlsCharacterMovementComponent.generated.h"
 
 using FAlsPhysicsRotationDelegate = TMulticastDelegate<void(float DeltaTime)>;
@@ -64,10 +65,66 @@ class ALS_API FAlsNetworkPredictionData : public FNetworkPredictionData_Client_C
 private:
 	using Super = FNetworkPredictionData_Client_Character;
 
+public:
+	// Number of saved moves allocated up front and put into the free moves list.
+	static constexpr auto PreallocatedMovesCount{32};
+
+	// Number of saved moves reused from the free moves list.
+	uint32 SavedMovesPoolHits{0};
+
+	// Number of saved moves that had to be allocated because the free moves list was empty.
+	uint32 SavedMovesPoolMisses{0};
+
 public:
 	explicit FAlsNetworkPredictionData(const UCharacterMovementComponent& Movement);
 
 	virtual FSavedMovePtr AllocateNewMove() override;
+
+	virtual FSavedMovePtr CreateSavedMove() override;
+};
+
+struct ALS_API FAlsFloorCache
+{
+	FFindFloorResult FloorResult;
+
+	FVector CapsuleLocation{ForceInit};
+
+	FQuat CapsuleRotation{ForceInit};
+
+	TWeakObjectPtr<const UPrimitiveComponent> MovementBase;
+
+	float LineDistance{0.0f};
+
+	float SweepDistance{0.0f};
+
+	float SweepRadius{0.0f};
+
+	float CapsuleRadius{0.0f};
+
+	float CapsuleHalfHeight{0.0f};
+
+	float WalkableFloorZ{0.0f};
+
+	bool bValid{false};
+};
+
+// Server move processing totals of a single character. Collected only while enabled, for example by the networking benchmark.
+// Move autonomous cycles include the time of the walking simulation and floor queries performed during the move.
+struct ALS_API FAlsServerMoveStatistics
+{
+	uint64 MoveAutonomousCycles{0};
+
+	uint64 PhysWalkingCycles{0};
+
+	uint64 ComputeFloorDistCycles{0};
+
+	int32 MovesCount{0};
+
+	int32 MovePacketsCount{0};
+
+	int64 MovePacketsBytes{0};
+
+	int32 CorrectionsCount{0};
 };
 
 UCLASS()
@@ -86,6 +143,14 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsMovementGaitSettings GaitSettings;
 
+	// Acceleration, braking deceleration, and ground friction sampled from the gait settings for the velocity
+	// below. Cached because they are requested several times with the same velocity during each simulation step.
+	mutable FVector3f AccelerationAndDecelerationAndGroundFriction{ForceInit};
+
+	mutable FVector2D AccelerationAndDecelerationAndGroundFrictionVelocity{ForceInit};
+
+	mutable bool bAccelerationAndDecelerationAndGroundFrictionValid{false};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTag RotationMode{AlsRotationModeTags::ViewDirection};
 
@@ -111,6 +176,21 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	bool bPrePenetrationAdjustmentVelocityValid;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsDerivedMovementState DerivedState;
+
+	// Result of the last floor query, reused by ComputeFloorDist() while the character stays in place on a static floor.
+	mutable FAlsFloorCache FloorCache;
+
+	// Location of the updated component at the end of the last walking simulation. Used to detect whether the character
+	// has been moved by something else since then, in which case the cached current floor is no longer valid.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FVector PreviousWalkingLocation{ForceInit};
+
+	bool bServerMoveStatisticsEnabled{false};
+
+	mutable FAlsServerMoveStatistics ServerMoveStatistics;
+
 public:
 	FAlsPhysicsRotationDelegate OnPhysicsRotation;
 
@@ -129,6 +209,8 @@ public:
 
 	virtual void UpdateBasedRotation(FRotator& FinalRotation, const FRotator& ReducedRotation) override;
 
+	virtual void OnTeleported() override;
+
 	virtual void CalcVelocity(float DeltaTime, float Friction, bool bFluid, float BrakingDeceleration) override;
 
 	virtual float GetMaxAcceleration() const override;
@@ -154,9 +236,13 @@ public:
 	virtual void ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult,
 	                              float SweepRadius, const FHitResult* DownwardSweepResult) const override;
 
+	void InvalidateFloorCache();
+
 protected:
 	virtual void PerformMovement(float DeltaTime) override;
 
+	virtual void SimulatedTick(float DeltaTime) override;
+
 public:
 	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
 
@@ -165,20 +251,43 @@ protected:
 
 	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAcceleration) override;
 
+public:
+	virtual void ServerMovePacked_ServerReceive(const FCharacterServerMovePackedBits& PackedBits) override;
+
+protected:
+	virtual bool ServerCheckClientError(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& ClientWorldLocation,
+	                                    const FVector& RelativeClientLocation, UPrimitiveComponent* ClientMovementBase,
+	                                    FName ClientBaseBoneName, uint8 ClientMovementMode) override;
+
 private:
 	void SavePenetrationAdjustment(const FHitResult& Hit);
 
 	void ApplyPendingPenetrationAdjustment();
 
+	bool CanSkipWalkingSimulation() const;
+
+	void ComputeFloorDistUncached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance,
+	                              FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const;
+
+	bool TryGetCachedFloor(const FVector& CapsuleLocation, float LineDistance, float SweepDistance,
+	                       float SweepRadius, FFindFloorResult& OutFloorResult) const;
+
+	void CacheFloor(const FVector& CapsuleLocation, float LineDistance, float SweepDistance,
+	                float SweepRadius, const FFindFloorResult& FloorResult) const;
+
 public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Character Movement")
 	void SetMovementSettings(UAlsMovementSettings* NewMovementSettings);
 
+	UAlsMovementSettings* GetMovementSettings() const;
+
 	const FAlsMovementGaitSettings& GetGaitSettings() const;
 
 private:
 	void RefreshGaitSettings();
 
+	void ApplyNetworkMoveState(const FGameplayTag& NewRotationMode, const FGameplayTag& NewStance, const FGameplayTag& NewMaxAllowedGait);
+
 public:
 	void SetRotationMode(const FGameplayTag& NewRotationMode);
 
@@ -189,15 +298,41 @@ public:
 private:
 	void RefreshMaxWalkSpeed();
 
+	const FVector3f& GetAccelerationAndDecelerationAndGroundFriction() const;
+
+	void RefreshDerivedState();
+
 public:
 	float CalculateGaitAmount() const;
 
+	const FAlsDerivedMovementState& GetDerivedState() const;
+
 	void SetMovementModeLocked(bool bNewMovementModeLocked);
 
 	bool TryConsumePrePenetrationAdjustmentVelocity(FVector& OutVelocity);
+
+	// Enabling server move statistics also resets them.
+	void SetServerMoveStatisticsEnabled(bool bNewServerMoveStatisticsEnabled);
+
+	const FAlsServerMoveStatistics& GetServerMoveStatistics() const;
 };
 
+inline UAlsMovementSettings* UAlsCharacterMovementComponent::GetMovementSettings() const
+{
+	return MovementSettings;
+}
+
 inline const FAlsMovementGaitSettings& UAlsCharacterMovementComponent::GetGaitSettings() const
 {
 	return GaitSettings;
 }
+
+inline const FAlsDerivedMovementState& UAlsCharacterMovementComponent::GetDerivedState() const
+{
+	return DerivedState;
+}
+
+inline const FAlsServerMoveStatistics& UAlsCharacterMovementComponent::GetServerMoveStatistics() const
+{
+	return ServerMoveStatistics;
+}
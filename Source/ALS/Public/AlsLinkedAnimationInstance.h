@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Animation/AnimInstance.h"
+#include "AlsAnimationInstance.h"
 #include "AlsLinkedAnimationInstance.generated.h"
 
 class AAlsCharacter;
@@ -11,12 +11,25 @@ class ALS_API UAlsLinkedAnimationInstance : public UAnimInstance
 	GENERATED_BODY()
 
 protected:
+	// If checked, NativeThreadSafeUpdateLayer() is called only when the parent's state has been updated since the previous update
+	// of this linked animation instance. Blueprint linked animation instances can also use bParentUpdated to skip their update.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Settings")
+	bool bSkipUpdateIfParentNotUpdated{false};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TWeakObjectPtr<UAlsAnimationInstance> Parent;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	TObjectPtr<AAlsCharacter> Character;
 
+	// True if the parent's state has been updated since the previous update of this linked animation instance.
+	// The parent's state values are not compared, so they may still be the same as in the previous update.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	bool bParentUpdated{true};
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	uint32 ParentUpdateRevision{0};
+
 public:
 	UAlsLinkedAnimationInstance();
 
@@ -24,9 +37,45 @@ public:
 
 	virtual void NativeBeginPlay() override;
 
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaTime) override;
+
 protected:
 	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override;
 
+	// Override this function instead of NativeThreadSafeUpdateAnimation()
+	// to be able to skip the update while the parent's state is not updated.
+	virtual void NativeThreadSafeUpdateLayer(float DeltaTime);
+
+	// These functions return references to the parent's state, so that native linked animation instances can read it during
+	// the worker thread update without copying it. This is safe because linked animation instances are updated as part of the
+	// parent's animation graph, after UAlsAnimationInstance::NativeThreadSafeUpdateAnimation() has finished. They must only be
+	// called while the linked animation instance has a valid parent, otherwise the parent's default object state is returned.
+
+	const FAlsLayeringState& GetParentLayeringState() const;
+
+	const FAlsPoseState& GetParentPoseState() const;
+
+	const FAlsViewAnimationState& GetParentViewState() const;
+
+	const FAlsLeanState& GetParentLeanState() const;
+
+	const FAlsLocomotionAnimationState& GetParentLocomotionState() const;
+
+	const FAlsGroundedState& GetParentGroundedState() const;
+
+	const FAlsInAirState& GetParentInAirState() const;
+
+	const FAlsFeetState& GetParentFeetState() const;
+
+	const FAlsTransitionsState& GetParentTransitionsState() const;
+
+	const FAlsRotateInPlaceState& GetParentRotateInPlaceState() const;
+
+	const FAlsTurnInPlaceState& GetParentTurnInPlaceState() const;
+
+private:
+	const UAlsAnimationInstance& GetParentChecked() const;
+
 protected:
 	// Be very careful when using this function to read your custom variables using the property access system. It is
 	// safe to use this function to read variables that change only inside UAlsAnimationInstance::NativeUpdateAnimation()
@@ -61,3 +110,58 @@ inline UAlsAnimationInstance* UAlsLinkedAnimationInstance::GetParentUnsafe() con
 {
 	return Parent.Get();
 }
+
+inline const FAlsLayeringState& UAlsLinkedAnimationInstance::GetParentLayeringState() const
+{
+	return GetParentChecked().LayeringState;
+}
+
+inline const FAlsPoseState& UAlsLinkedAnimationInstance::GetParentPoseState() const
+{
+	return GetParentChecked().PoseState;
+}
+
+inline const FAlsViewAnimationState& UAlsLinkedAnimationInstance::GetParentViewState() const
+{
+	return GetParentChecked().ViewState;
+}
+
+inline const FAlsLeanState& UAlsLinkedAnimationInstance::GetParentLeanState() const
+{
+	return GetParentChecked().LeanState;
+}
+
+inline const FAlsLocomotionAnimationState& UAlsLinkedAnimationInstance::GetParentLocomotionState() const
+{
+	return GetParentChecked().LocomotionState;
+}
+
+inline const FAlsGroundedState& UAlsLinkedAnimationInstance::GetParentGroundedState() const
+{
+	return GetParentChecked().GroundedState;
+}
+
+inline const FAlsInAirState& UAlsLinkedAnimationInstance::GetParentInAirState() const
+{
+	return GetParentChecked().InAirState;
+}
+
+inline const FAlsFeetState& UAlsLinkedAnimationInstance::GetParentFeetState() const
+{
+	return GetParentChecked().FeetState;
+}
+
+inline const FAlsTransitionsState& UAlsLinkedAnimationInstance::GetParentTransitionsState() const
+{
+	return GetParentChecked().TransitionsState;
+}
+
+inline const FAlsRotateInPlaceState& UAlsLinkedAnimationInstance::GetParentRotateInPlaceState() const
+{
+	return GetParentChecked().RotateInPlaceState;
+}
+
+inline const FAlsTurnInPlaceState& UAlsLinkedAnimationInstance::GetParentTurnInPlaceState() const
+{
+	return GetParentChecked().TurnInPlaceState;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "BoneControllers/AnimNode_SkeletalControlBase.h"
+#include "State/AlsControlRigInput.h"
+#include "AlsAnimNode_FeetAndHandsIk.generated.h"
+
+// Applies only the feet and hands part of the ALS control rig directly on the component space pose: the pelvis offset,
+// the foot IK calculated by the animation instance (foot locking, foot offset and foot limits are already baked into the
+// rig input), and the hand IK retargeting. It is not a full replacement for the control rig. The spine rotation
+// (SpineYawAngle), the diagonal scaling (VelocityBlendForwardAmount and VelocityBlendBackwardAmount) and the clamping of
+// the foot IK locations by leg length are not performed, and bUseFootIkBones is ignored. The pelvis is only ever lowered,
+// so only the minimum of MinMaxPelvisOffsetZ is used. Use it only in animation blueprints that don't need those features.
+USTRUCT(BlueprintInternalUseOnly)
+struct ALS_API FAlsAnimNode_FeetAndHandsIk : public FAnimNode_SkeletalControlBase
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (PinShownByDefault))
+	FAlsControlRigInput RigInput;
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference PelvisBone{TEXT("pelvis")};
+
+	// The calf and thigh bones are taken from the parents of the foot bone.
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference FootLeftBone{TEXT("foot_l")};
+
+	// The calf and thigh bones are taken from the parents of the foot bone.
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference FootRightBone{TEXT("foot_r")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference HandLeftBone{TEXT("hand_l")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference HandLeftIkBone{TEXT("ik_hand_l")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference HandRightBone{TEXT("hand_r")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference HandRightIkBone{TEXT("ik_hand_r")};
+
+	// Bones that are moved by the hand IK retargeting offset.
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	TArray<FBoneReference> HandIkBonesToMove{FBoneReference{TEXT("ik_hand_root")}};
+
+	// Which hand to favor. 0.5 is equal weight for both, 1 - right hand, 0 - left hand.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 1, PinShownByDefault))
+	float HandIkRetargetingWeight{0.5f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 1, PinHiddenByDefault))
+	float HandIkRetargetingAmount{1.0f};
+
+protected:
+	FCompactPoseBoneIndex ThighLeftIndex{INDEX_NONE};
+
+	FCompactPoseBoneIndex CalfLeftIndex{INDEX_NONE};
+
+	FCompactPoseBoneIndex ThighRightIndex{INDEX_NONE};
+
+	FCompactPoseBoneIndex CalfRightIndex{INDEX_NONE};
+
+	TArray<bool, TInlineAllocator<4>> HandIkBonesToMoveUnderPelvis;
+
+	bool bHandLeftUnderPelvis{false};
+
+	bool bHandLeftIkUnderPelvis{false};
+
+	bool bHandRightUnderPelvis{false};
+
+	bool bHandRightIkUnderPelvis{false};
+
+public:
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+
+	virtual void EvaluateSkeletalControl_AnyThread(FComponentSpacePoseContext& Output,
+	                                               TArray<FBoneTransform>& OutBoneTransforms) override;
+
+	virtual bool IsValidToEvaluate(const USkeleton* Skeleton, const FBoneContainer& RequiredBones) override;
+
+protected:
+	virtual void InitializeBoneReferences(const FBoneContainer& RequiredBones) override;
+
+private:
+	void EvaluateFeetIk(FCSPose<FCompactPose>& Pose, TArray<FBoneTransform>& OutBoneTransforms, float& PelvisOffsetZ) const;
+
+	void EvaluateHandsIkRetargeting(FCSPose<FCompactPose>& Pose, float PelvisOffsetZ, TArray<FBoneTransform>& OutBoneTransforms) const;
+};
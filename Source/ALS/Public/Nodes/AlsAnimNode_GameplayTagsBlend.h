@@ -16,8 +16,22 @@ public:
 
 	UPROPERTY(EditAnywhere, Category = "Settings", Meta = (FoldProperty))
 	TArray<FGameplayTag> Tags;
+
+	// If checked and the active tag is not in the tags list, then the pose of its closest parent tag from the list is used.
+	UPROPERTY(EditAnywhere, Category = "Settings", Meta = (FoldProperty))
+	bool bMatchTagHierarchy{false};
 #endif
 
+protected:
+	TMap<FGameplayTag, int32> ChildIndices;
+
+	FGameplayTag PreviousActiveTag;
+
+	int32 PreviousActiveChildIndex{0};
+
+public:
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+
 protected:
 	virtual int32 GetActiveChildIndex() override;
 
@@ -26,6 +40,8 @@ public:
 
 	const TArray<FGameplayTag>& GetTags() const;
 
+	bool IsMatchTagHierarchy() const;
+
 #if WITH_EDITOR
 	void RefreshPoses();
 #endif
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Animation/AnimNodeBase.h"
+#include "BoneContainer.h"
+#include "State/AlsLayeringState.h"
+#include "AlsAnimNode_Layering.generated.h"
+
+// Applies all ALS layering blends (base, additive, local and mesh space additive, and slot blends for each body
+// region) in a single pass over the pose. Each bone is assigned to a body region once when bones are cached, and
+// regions whose blend amounts are zero are left untouched, so the overlay, reference and slot poses are only
+// evaluated when at least one region needs them. Bones outside all regions use the pelvis blend amounts.
+USTRUCT(BlueprintInternalUseOnly)
+struct ALS_API FAlsAnimNode_Layering : public FAnimNode_Base
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	FPoseLink BasePose;
+
+	// The pose the base pose is compared against to extract the base additive, usually the neutral standing or crouching pose.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	FPoseLink BaseReferencePose;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	FPoseLink OverlayPose;
+
+	// Usually a slot node. It is only evaluated while a montage is playing in the slot.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	FPoseLink SlotPose;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (PinShownByDefault))
+	FAlsLayeringState LayeringState;
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FName SlotName{TEXT("DefaultSlot")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference LegLeftBone{TEXT("thigh_l")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference LegRightBone{TEXT("thigh_r")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference SpineBone{TEXT("spine_01")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference HeadBone{TEXT("neck_01")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference ArmLeftBone{TEXT("clavicle_l")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference ArmRightBone{TEXT("clavicle_r")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference HandLeftBone{TEXT("hand_l")};
+
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FBoneReference HandRightBone{TEXT("hand_r")};
+
+protected:
+	enum class ERegion : uint8
+	{
+		Pelvis,
+		Legs,
+		Spine,
+		Head,
+		ArmLeft,
+		ArmRight,
+		HandLeft,
+		HandRight,
+		Count
+	};
+
+	struct FRegionBlend
+	{
+		float OverlayAmount{0.0f};
+
+		float AdditiveAmount{0.0f};
+
+		float LocalSpaceAmount{1.0f};
+
+		float SlotAmount{0.0f};
+
+		bool bRelevant{false};
+
+		bool bMeshSpaceAdditive{false};
+	};
+
+	// Body region of each bone, indexed by the compact pose bone index.
+	TArray<ERegion> BoneRegions;
+
+	FRegionBlend RegionBlends[static_cast<uint8>(ERegion::Count)];
+
+	bool bOverlayRelevant{false};
+
+	bool bAdditiveRelevant{false};
+
+	bool bMeshSpaceAdditiveRelevant{false};
+
+	bool bSlotRelevant{false};
+
+public:
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+
+	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
+
+	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) override;
+
+	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
+
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+
+private:
+	void RefreshRegionBlends(float SlotWeight);
+
+	void SetRegionBlend(ERegion Region, float OverlayAmount, float AdditiveAmount,
+	                    float LocalSpaceAmount, float MeshSpaceAmount, float SlotAmount);
+};
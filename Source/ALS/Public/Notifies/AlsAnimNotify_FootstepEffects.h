@@ -2,6 +2,7 @@
 
 #include "Animation/AnimNotifies/AnimNotify.h"
 #include "Engine/DataAsset.h"
+#include "Containers/StaticArray.h"
 #include "Engine/EngineTypes.h"
 #include "AlsAnimNotify_FootstepEffects.generated.h"
 
@@ -128,6 +129,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float SurfaceTraceDistance{50.0f};
 
+	// If the foot IK trace hit stored in the animation instance is not older than this value, then it is used instead of
+	// performing a separate surface trace. Requires the foot IK trace to return the physical material and to use the same
+	// trace channel as the surface trace, otherwise the separate trace is always performed. Zero disables this.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float FootIkGroundHitMaxAge{0.1f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", DisplayName = "Foot Left Y Axis")
 	FVector3f FootLeftYAxis{0.0f, 0.0f, 1.0f};
 
@@ -150,12 +157,37 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ForceInlineRow))
 	TMap<TEnumAsByte<EPhysicalSurface>, FAlsFootstepEffectSettings> Effects;
 
+	static constexpr auto SurfaceTypesCount{64};
+
+	// Copies of the Effects map values. They are copied so that the lookup never points into the map, whose
+	// elements can be moved by any change to the map. Must be refreshed with RefreshEffectsLookup() after such a change.
+	TArray<FAlsFootstepEffectSettings> EffectsLookupSettings;
+
+	// Indices into EffectsLookupSettings by surface type. Surface types not present in the map use
+	// the first entry of the map. All indices are INDEX_NONE while the map is empty.
+	TStaticArray<int32, SurfaceTypesCount> EffectsLookup{InPlace, INDEX_NONE};
+
 public:
+	virtual void PostInitProperties() override;
+
+	virtual void PostLoad() override;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
+
+	void RefreshEffectsLookup();
+
+	const FAlsFootstepEffectSettings* FindEffectSettings(EPhysicalSurface SurfaceType) const;
 };
 
+inline const FAlsFootstepEffectSettings* UAlsFootstepEffectsSettings::FindEffectSettings(const EPhysicalSurface SurfaceType) const
+{
+	const auto Index{EffectsLookup[static_cast<int32>(SurfaceType) & (SurfaceTypesCount - 1)]};
+
+	return Index != INDEX_NONE ? &EffectsLookupSettings[Index] : nullptr;
+}
+
 UCLASS(DisplayName = "Als Footstep Effects Animation Notify",
 	AutoExpandCategories = ("Settings|Sound", "Settings|Decal", "Settings|Particle System"))
 class ALS_API UAlsAnimNotify_FootstepEffects : public UAnimNotify
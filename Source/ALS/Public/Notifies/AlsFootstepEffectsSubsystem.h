@@ -0,0 +1,159 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsFootstepEffectsSubsystem.generated.h"
+
+class UDecalComponent;
+class UMaterialInterface;
+class UNiagaraComponent;
+class UNiagaraSystem;
+class USceneComponent;
+
+USTRUCT()
+struct ALS_API FAlsFootstepDecalRequest
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TObjectPtr<UMaterialInterface> Material;
+
+	UPROPERTY()
+	TWeakObjectPtr<USceneComponent> AttachComponent;
+
+	FVector Location{ForceInit};
+
+	FQuat Rotation{ForceInit};
+
+	FVector Size{ForceInit};
+
+	float Duration{0.0f};
+
+	float FadeOutDuration{0.0f};
+
+	float ViewDistanceSquared{0.0f};
+};
+
+USTRUCT()
+struct ALS_API FAlsFootstepParticleSystemRequest
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TObjectPtr<UNiagaraSystem> System;
+
+	// If set, the particle system is attached to this component, and the location and rotation are relative to the
+	// socket. The request is discarded if the component is destroyed before the particle system is spawned.
+	UPROPERTY()
+	TWeakObjectPtr<USceneComponent> AttachComponent;
+
+	FName AttachSocketName;
+
+	FVector Location{ForceInit};
+
+	FQuat Rotation{ForceInit};
+
+	FVector Scale{ForceInit};
+
+	float ViewDistanceSquared{0.0f};
+};
+
+USTRUCT()
+struct ALS_API FAlsPooledFootstepDecal
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TObjectPtr<UDecalComponent> Decal;
+
+	double ExpirationTime{0.0};
+};
+
+// Collects footstep decal and particle system spawn requests during the frame and spawns them at the end of the
+// frame within a per-frame budget, prioritizing footsteps closest to the local players. Decals are recycled from a
+// fixed-size ring buffer, so the oldest decal is reused when the maximum number of live decals is reached. Particle
+// systems are spawned through the Niagara component pool, but their number of live instances is also limited.
+// Not created on dedicated servers, and footsteps are not spawned at all while there are no local players.
+UCLASS(Config = Engine)
+class ALS_API UAlsFootstepEffectsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config, VisibleAnywhere, Category = "Settings", Meta = (ClampMin = 1))
+	int32 MaxLiveDecals{64};
+
+	UPROPERTY(Config, VisibleAnywhere, Category = "Settings", Meta = (ClampMin = 0))
+	int32 MaxDecalsPerFrame{4};
+
+	UPROPERTY(Config, VisibleAnywhere, Category = "Settings", Meta = (ClampMin = 0))
+	int32 MaxLiveParticleSystems{32};
+
+	UPROPERTY(Config, VisibleAnywhere, Category = "Settings", Meta = (ClampMin = 0))
+	int32 MaxParticleSystemsPerFrame{4};
+
+	// Footstep effects farther than this distance from all local players are not spawned. Zero means no limit
+	// as long as there is at least one local player.
+	UPROPERTY(Config, VisibleAnywhere, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MaxSpawnDistance{5000.0f};
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<FAlsPooledFootstepDecal> Decals;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	int32 NextDecalIndex{0};
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<TWeakObjectPtr<UNiagaraComponent>> LiveParticleSystems;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<FAlsFootstepDecalRequest> PendingDecals;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<FAlsFootstepParticleSystemRequest> PendingParticleSystems;
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+
+	uint64 ViewLocationsFrame{0};
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	// Returns false if the request was rejected because the footstep is too far from all local players or there are none.
+	bool QueueDecal(FAlsFootstepDecalRequest&& Request);
+
+	// Returns false if the request was rejected because the footstep is too far from all local players or there are none.
+	bool QueueParticleSystem(FAlsFootstepParticleSystemRequest&& Request);
+
+private:
+	// Returns the maximum float value if there are no local players.
+	float CalculateViewDistanceSquared(const FVector& Location);
+
+	bool IsWithinSpawnDistance(float ViewDistanceSquared) const;
+
+	void RefreshDecals();
+
+	void SpawnDecal(const FAlsFootstepDecalRequest& Request);
+
+	void RefreshParticleSystems();
+
+	void SpawnParticleSystem(const FAlsFootstepParticleSystemRequest& Request);
+};
+
+inline bool UAlsFootstepEffectsSubsystem::IsWithinSpawnDistance(const float ViewDistanceSquared) const
+{
+	return ViewDistanceSquared < TNumericLimits<float>::Max() &&
+	       (MaxSpawnDistance <= 0.0f || ViewDistanceSquared <= FMath::Square(MaxSpawnDistance));
+}
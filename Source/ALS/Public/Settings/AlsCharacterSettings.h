@@ -37,6 +37,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	bool bRotateTowardsDesiredVelocityInVelocityDirectionRotationMode{true};
 
+	// If checked, all desired state changes (gait, stance, rotation mode, aiming, view mode and overlay mode) made
+	// during a frame are sent at the end of the frame in a single reliable RPC, instead of one reliable RPC per change.
+	// The coalesced RPC is sent from the character's tick, so changes are sent immediately while its tick is disabled.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bCoalesceDesiredStateRpcs{false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsViewSettings View;
 
@@ -65,6 +65,11 @@ struct ALS_API FAlsFeetSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float IkTraceDistanceDownward{45.0f};
 
+	// If checked, the foot IK trace also returns the physical material and the last trace hit of each foot is stored in
+	// the feet state, so footstep effects can reuse it instead of performing their own surface trace.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bReturnIkTracePhysicalMaterial{false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FAlsFootLimitsSettings LeftFootLimits;
 
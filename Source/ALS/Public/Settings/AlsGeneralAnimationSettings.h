@@ -18,4 +18,35 @@ struct ALS_API FAlsGeneralAnimationSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
 	float LeanInterpolationSpeed{4.0f};
+
+	// If checked, while the character is fully idle (no input, no movement, no montages, no view changes), the animation
+	// instance state is updated only every few frames, and the skipped time is caught up by the next update.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bAllowIdleUpdateRateReduction{true};
+
+	// How long the character must stay fully idle before the reduced update rate is used.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowIdleUpdateRateReduction", ForceUnits = "s"))
+	float IdleUpdateRateReductionDelay{0.5f};
+
+	// The animation instance state is updated once every this number of frames while the character is idle.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, ClampMax = 16, EditCondition = "bAllowIdleUpdateRateReduction"))
+	int32 IdleUpdateInterval{4};
+
+	// If checked, the animation instance of a simulated proxy that has not been rendered for a while is neither updated nor
+	// evaluated at all, and the mesh holds its last pose. When the character becomes visible again, the animation graph can
+	// blend out of the snapshot of the frozen pose. Only check this if your animation blueprint blends out of the snapshot
+	// using the frozen pose state, otherwise the character snaps back to an up-to-date pose when it becomes visible again.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bAllowPoseFreezing{false};
+
+	// How long the mesh must not be rendered before its pose is frozen.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowPoseFreezing", ForceUnits = "s"))
+	float PoseFreezingDelay{1.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, EditCondition = "bAllowPoseFreezing", ForceUnits = "s"))
+	float PoseUnfreezingBlendDuration{0.2f};
 };
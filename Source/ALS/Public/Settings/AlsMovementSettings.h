@@ -32,8 +32,25 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveFloat> RotationInterpolationSpeedCurve{nullptr};
 
+	static constexpr auto AccelerationAndDecelerationAndGroundFrictionTableResolution{32};
+
+	// Acceleration and deceleration and ground friction curve sampled at a fixed number of points per gait, with all
+	// three channels interleaved. Refreshed by the movement settings when they are loaded or changed.
+	TArray<float> AccelerationAndDecelerationAndGroundFrictionTable;
+
+	// Curve from which the table was sampled. Only used to detect that the curve was replaced at runtime, never dereferenced.
+	const UCurveVector* AccelerationAndDecelerationAndGroundFrictionTableCurve{nullptr};
+
 public:
 	float GetSpeedByGait(const FGameplayTag& Gait) const;
+
+	void RefreshAccelerationAndDecelerationAndGroundFrictionTable();
+
+	// Falls back to evaluating the curve if the table is empty or was sampled from a different curve.
+	FVector3f SampleAccelerationAndDecelerationAndGroundFriction(float GaitAmount) const;
+
+private:
+	FVector3f EvaluateAccelerationAndDecelerationAndGroundFrictionCurve(float GaitAmount) const;
 };
 
 USTRUCT(BlueprintType)
@@ -62,6 +79,18 @@ public:
 		{AlsRotationModeTags::ViewDirection, {}},
 		{AlsRotationModeTags::Aiming, {}}
 	};
+
+public:
+	virtual void PostInitProperties() override;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void RefreshAccelerationAndDecelerationAndGroundFrictionTables();
 };
 
 inline float FAlsMovementGaitSettings::GetSpeedByGait(const FGameplayTag& Gait) const
@@ -83,3 +112,29 @@ inline float FAlsMovementGaitSettings::GetSpeedByGait(const FGameplayTag& Gait)
 
 	return 0.0f;
 }
+
+inline FVector3f FAlsMovementGaitSettings::SampleAccelerationAndDecelerationAndGroundFriction(const float GaitAmount) const
+{
+	static constexpr auto ChannelsCount{3};
+
+	const auto SamplesCount{AccelerationAndDecelerationAndGroundFrictionTable.Num() / ChannelsCount};
+	if (SamplesCount <= 1 ||
+	    AccelerationAndDecelerationAndGroundFrictionTableCurve != AccelerationAndDecelerationAndGroundFrictionCurve.Get())
+	{
+		return EvaluateAccelerationAndDecelerationAndGroundFrictionCurve(GaitAmount);
+	}
+
+	const auto Position{FMath::Clamp(GaitAmount * AccelerationAndDecelerationAndGroundFrictionTableResolution, 0.0f,
+	                                 static_cast<float>(SamplesCount - 1))};
+
+	const auto Index{FMath::Min(FMath::FloorToInt32(Position), SamplesCount - 2)};
+	const auto Alpha{Position - Index};
+
+	const auto* Sample{&AccelerationAndDecelerationAndGroundFrictionTable[Index * ChannelsCount]};
+
+	return {
+		FMath::Lerp(Sample[0], Sample[ChannelsCount], Alpha),
+		FMath::Lerp(Sample[1], Sample[ChannelsCount + 1], Alpha),
+		FMath::Lerp(Sample[2], Sample[ChannelsCount + 2], Alpha)
+	};
+}
@@ -12,4 +12,12 @@ struct ALS_API FAlsViewSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
 	bool bEnableListenServerNetworkSmoothing{true};
+
+	// The view rotation is replicated only when its pitch or yaw changes by more than this angle.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 10, ForceUnits = "deg"))
+	float ReplicationAngleThreshold{0.1f};
+
+	// Maximum number of times per second the view rotation is sent from the client to the server. Zero means no limit.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "Hz"))
+	float MaxReplicationSendRate{60.0f};
 };
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "AlsDerivedMovementState.generated.h"
+
+// Values derived from the character movement state, computed once by the character movement component after each
+// movement update, so that the animation instance does not have to query the movement and capsule components every frame.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsDerivedMovementState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float MaxAcceleration{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float MaxBrakingDeceleration{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float WalkableFloorZ{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CapsuleRadius{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CapsuleHalfHeight{0.0f};
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "AlsDesiredStateChanges.generated.h"
+
+enum class EAlsDesiredStateFlags : uint8
+{
+	None = 0,
+	DesiredAiming = 1 << 0,
+	DesiredRotationMode = 1 << 1,
+	DesiredStance = 1 << 2,
+	DesiredGait = 1 << 3,
+	ViewMode = 1 << 4,
+	OverlayMode = 1 << 5,
+	All = DesiredAiming | DesiredRotationMode | DesiredStance | DesiredGait | ViewMode | OverlayMode
+};
+
+ENUM_CLASS_FLAGS(EAlsDesiredStateFlags)
+
+// Desired state changes made during a single frame, packed into a single RPC. Only the values whose flags are set are serialized.
+USTRUCT()
+struct ALS_API FAlsDesiredStateChanges
+{
+	GENERATED_BODY()
+
+	EAlsDesiredStateFlags Flags{EAlsDesiredStateFlags::None};
+
+	UPROPERTY()
+	bool bDesiredAiming{false};
+
+	UPROPERTY()
+	FGameplayTag DesiredRotationMode;
+
+	UPROPERTY()
+	FGameplayTag DesiredStance;
+
+	UPROPERTY()
+	FGameplayTag DesiredGait;
+
+	UPROPERTY()
+	FGameplayTag ViewMode;
+
+	UPROPERTY()
+	FGameplayTag OverlayMode;
+
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAlsDesiredStateChanges> : public TStructOpsTypeTraitsBase2<FAlsDesiredStateChanges>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+inline bool FAlsDesiredStateChanges::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	static constexpr auto FlagsBitsCount{6};
+
+	auto PackedFlags{static_cast<uint8>(Flags)};
+	Archive.SerializeBits(&PackedFlags, FlagsBitsCount);
+
+	if (Archive.IsLoading())
+	{
+		Flags = static_cast<EAlsDesiredStateFlags>(PackedFlags) & EAlsDesiredStateFlags::All;
+	}
+
+	bSuccess = true;
+
+	if (EnumHasAnyFlags(Flags, EAlsDesiredStateFlags::DesiredAiming))
+	{
+		uint8 bPackedDesiredAiming{bDesiredAiming};
+		Archive.SerializeBits(&bPackedDesiredAiming, 1);
+		bDesiredAiming = (bPackedDesiredAiming & 1) != 0;
+	}
+
+	auto bSuccessLocal{true};
+
+	if (EnumHasAnyFlags(Flags, EAlsDesiredStateFlags::DesiredRotationMode))
+	{
+		DesiredRotationMode.NetSerialize(Archive, Map, bSuccessLocal);
+		bSuccess &= bSuccessLocal;
+	}
+
+	if (EnumHasAnyFlags(Flags, EAlsDesiredStateFlags::DesiredStance))
+	{
+		DesiredStance.NetSerialize(Archive, Map, bSuccessLocal);
+		bSuccess &= bSuccessLocal;
+	}
+
+	if (EnumHasAnyFlags(Flags, EAlsDesiredStateFlags::DesiredGait))
+	{
+		DesiredGait.NetSerialize(Archive, Map, bSuccessLocal);
+		bSuccess &= bSuccessLocal;
+	}
+
+	if (EnumHasAnyFlags(Flags, EAlsDesiredStateFlags::ViewMode))
+	{
+		ViewMode.NetSerialize(Archive, Map, bSuccessLocal);
+		bSuccess &= bSuccessLocal;
+	}
+
+	if (EnumHasAnyFlags(Flags, EAlsDesiredStateFlags::OverlayMode))
+	{
+		OverlayMode.NetSerialize(Archive, Map, bSuccessLocal);
+		bSuccess &= bSuccessLocal;
+	}
+
+	return bSuccess;
+}
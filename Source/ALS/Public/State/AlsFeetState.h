@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "Engine/HitResult.h"
 #include "Utility/AlsMath.h"
 #include "AlsFeetState.generated.h"
 
@@ -58,6 +59,13 @@ struct ALS_API FAlsFootState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FQuat IkRotation{ForceInit};
+
+	// Last hit of the foot IK trace. Only stored if the foot IK trace is configured to return the physical material.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FHitResult GroundHit;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float GroundHitTime{0.0f};
 };
 
 USTRUCT(BlueprintType)
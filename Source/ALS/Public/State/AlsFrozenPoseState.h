@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Animation/PoseSnapshot.h"
+#include "AlsFrozenPoseState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsFrozenPoseState
+{
+	GENERATED_BODY()
+
+	// True while the animation instance is neither updated nor evaluated, and the mesh holds its last pose.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bFrozen{false};
+
+	// Pose captured when the animation instance was frozen. Used in the animation graph to blend out of the frozen pose.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FPoseSnapshot Pose;
+
+	// Set to 1 when the animation instance is unfrozen, and then decreases to 0 over the unfreezing blend duration.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float BlendAmount{0.0f};
+};
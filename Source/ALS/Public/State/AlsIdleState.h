@@ -0,0 +1,30 @@
+#pragma once
+
+#include "AlsIdleState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsIdleState
+{
+	GENERATED_BODY()
+
+	// True if the character has been fully idle long enough to update the animation instance state at a reduced rate.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bIdle{false};
+
+	// True if the thread-safe state update is skipped in the current frame.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bUpdateSkipped{false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float IdleTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 SkippedFramesCount{0};
+
+	// Delta time accumulated over the skipped frames, which is added to the delta time of the next state update.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float SkippedDeltaTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator ViewRotation{ForceInit};
+};
@@ -40,6 +40,11 @@ struct ALS_API FAlsLocomotionAnimationState
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	bool bMovingSmooth{false};
 
+	// True if the character is grounded and not moving, in any stance. Transitions, rotate in place
+	// and turn in place can only be activated in this state, so they are not refreshed otherwise.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	bool bStationary{false};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
 	float TargetYawAngle{0.0f};
 
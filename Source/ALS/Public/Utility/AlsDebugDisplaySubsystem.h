@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsDebugDisplaySubsystem.generated.h"
+
+class AHUD;
+
+// Caches the debug display state of the first player's HUD once per frame, so checking whether debug should be
+// displayed for an actor is only a comparison and a bit test, no matter how many characters do it. Every debug
+// display name gets its own bit in the order in which it is first queried, up to the size of the bit mask.
+UCLASS()
+class ALS_API UAlsDebugDisplaySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr auto MaxDisplayNamesCount{64};
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TArray<FName> DisplayNames;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TWeakObjectPtr<AHUD> Hud;
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	TWeakObjectPtr<AActor> DebugTargetActor;
+
+	uint64 DisplayNamesMask{0};
+
+	uint64 CacheFrame{0};
+
+public:
+	virtual void Deinitialize() override;
+
+	// Must be called only from the game thread.
+	bool ShouldDisplayDebugForActor(const AActor* Actor, const FName& DisplayName);
+
+private:
+	void RefreshCache();
+};
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "AlsDebugDrawSubsystem.generated.h"
+
+struct FHitResult;
+
+enum class EAlsDebugDrawCommandType : uint8
+{
+	Line,
+	LineTraceSingle,
+	SweepSphere,
+	SweepSingleSphere,
+	SweepSingleCapsule,
+	SweepSingleCapsuleAlternative,
+	Sphere,
+	Capsule,
+	CoordinateSystem
+};
+
+// Plain data record of a single debug draw. Only the parts of the hit result that are actually drawn are stored, so
+// recording a command never allocates memory. Radius is used as the scale of the coordinate system.
+struct ALS_API FAlsDebugDrawCommand
+{
+	EAlsDebugDrawCommandType Type{EAlsDebugDrawCommandType::LineTraceSingle};
+
+	bool bHit{false};
+
+	FVector Start{ForceInit};
+
+	FVector End{ForceInit};
+
+	FQuat Rotation{ForceInit};
+
+	FVector HitLocation{ForceInit};
+
+	FVector HitImpactPoint{ForceInit};
+
+	float Radius{0.0f};
+
+	float HalfHeight{0.0f};
+
+	FLinearColor Color{ForceInit};
+
+	FLinearColor HitColor{ForceInit};
+
+	float Duration{0.0f};
+
+	float Thickness{1.0f};
+};
+
+// Collects debug draw commands from any thread into a fixed-size ring buffer and draws them once per frame on the game
+// thread. When the buffer is full, the oldest commands are overwritten, so no memory is allocated after initialization.
+// Created only in builds with debug drawing enabled, so callers must check that the subsystem exists.
+UCLASS(Config = Engine)
+class ALS_API UAlsDebugDrawSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config, VisibleAnywhere, Category = "Settings", Meta = (ClampMin = 1))
+	int32 MaxCommands{1024};
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	int32 FirstCommandIndex{0};
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	int32 CommandsCount{0};
+
+	UPROPERTY(VisibleAnywhere, Category = "State", Transient)
+	int32 OverwrittenCommandsCount{0};
+
+	FCriticalSection CommandsLock;
+
+	TArray<FAlsDebugDrawCommand> Commands;
+
+	TArray<FAlsDebugDrawCommand> DrawnCommands;
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	void QueueLine(const FVector& Start, const FVector& End, const FLinearColor& Color,
+	               float Duration = 0.0f, float Thickness = 1.0f);
+
+	void QueueLineTraceSingle(const FVector& Start, const FVector& End, bool bHit, const FHitResult& Hit,
+	                          const FLinearColor& TraceColor, const FLinearColor& HitColor,
+	                          float Duration = 0.0f, float Thickness = 1.0f);
+
+	void QueueSweepSphere(const FVector& Start, const FVector& End, float Radius, const FLinearColor& Color,
+	                      float Duration = 0.0f, float Thickness = 1.0f);
+
+	void QueueSweepSingleSphere(const FVector& Start, const FVector& End, float Radius, bool bHit, const FHitResult& Hit,
+	                            const FLinearColor& SweepColor, const FLinearColor& HitColor,
+	                            float Duration = 0.0f, float Thickness = 1.0f);
+
+	void QueueSweepSingleCapsule(const FVector& Start, const FVector& End, const FQuat& Rotation, float Radius, float HalfHeight,
+	                             bool bHit, const FHitResult& Hit, const FLinearColor& SweepColor, const FLinearColor& HitColor,
+	                             float Duration = 0.0f, float Thickness = 1.0f);
+
+	void QueueSweepSingleCapsuleAlternative(const FVector& Start, const FVector& End, float Radius, float HalfHeight,
+	                                        bool bHit, const FHitResult& Hit, const FLinearColor& SweepColor,
+	                                        const FLinearColor& HitColor, float Duration = 0.0f, float Thickness = 1.0f);
+
+	void QueueSphere(const FVector& Location, const FQuat& Rotation, float Radius, const FLinearColor& Color,
+	                 float Duration = 0.0f, float Thickness = 1.0f);
+
+	void QueueCapsule(const FVector& Location, const FQuat& Rotation, float Radius, float HalfHeight,
+	                  const FLinearColor& Color, float Duration = 0.0f, float Thickness = 1.0f);
+
+	void QueueCoordinateSystem(const FVector& Location, const FQuat& Rotation, float Scale,
+	                           float Duration = 0.0f, float Thickness = 1.0f);
+
+private:
+	void QueueCommand(const FAlsDebugDrawCommand& Command);
+
+	void DrawCommand(const FAlsDebugDrawCommand& Command) const;
+};
@@ -151,6 +151,13 @@ public:
 		Meta = (AutoCreateRefTerm = "ALocation, BLocation, CLocation", ExpandBoolAsExecs = "ReturnValue"))
 	static bool TryCalculatePoleVector(const FVector& ALocation, const FVector& BLocation, const FVector& CLocation,
 	                                   FVector& ProjectionLocation, FVector& Direction);
+
+	// Transforms several locations and rotations by the same transform. The transform is loaded into vector registers only
+	// once, and the same vector operations as in FTransform::TransformPosition() and FTransform::TransformRotation() are
+	// used, so the results are identical to transforming each location and rotation separately.
+	static void TransformLocationsAndRotations(const FTransform& Transform, TConstArrayView<FVector> Locations,
+	                                           TConstArrayView<FQuat> Rotations, TArrayView<FVector> TransformedLocations,
+	                                           TArrayView<FQuat> TransformedRotations);
 };
 
 template <typename ValueType>
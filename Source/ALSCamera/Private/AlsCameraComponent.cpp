@@ -1,11 +1,11 @@
 #include "AlsCameraComponent.h"
 
 #include "AlsCameraSettings.h"
-#include "DrawDebugHelpers.h"
 #include "Animation/AnimInstance.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/WorldSettings.h"
 #include "Utility/AlsCameraConstants.h"
+#include "Utility/AlsDebugDrawSubsystem.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsUtility.h"
 
@@ -143,7 +143,10 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	                   __FUNCTION__);
 
 #if ENABLE_DRAW_DEBUG
+	auto* DebugDrawSubsystem{GetWorld()->GetSubsystem<UAlsDebugDrawSubsystem>()};
+
 	const auto bDisplayDebugCameraShapes{
+		IsValid(DebugDrawSubsystem) &&
 		UAlsUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraShapesDebugDisplayName())
 	};
 #else
@@ -231,7 +234,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 #if ENABLE_DRAW_DEBUG
 	if (bDisplayDebugCameraShapes)
 	{
-		UAlsUtility::DrawDebugSphereAlternative(GetWorld(), PivotTargetLocation, CameraYawRotation, 16.0f, FLinearColor::Green);
+		DebugDrawSubsystem->QueueSphere(PivotTargetLocation, CameraYawRotation.Quaternion(), 16.0f, FLinearColor::Green);
 	}
 #endif
 
@@ -253,11 +256,10 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 #if ENABLE_DRAW_DEBUG
 	if (bDisplayDebugCameraShapes)
 	{
-		DrawDebugLine(GetWorld(), PivotLagLocation, PivotTargetLocation,
-		              FLinearColor{1.0f, 0.5f, 0.0f}.ToFColor(true),
-		              false, 0.0f, 0, UAlsUtility::DrawLineThickness);
+		DebugDrawSubsystem->QueueLine(PivotLagLocation, PivotTargetLocation, {1.0f, 0.5f, 0.0f},
+		                              0.0f, UAlsUtility::DrawLineThickness);
 
-		UAlsUtility::DrawDebugSphereAlternative(GetWorld(), PivotLagLocation, CameraYawRotation, 16.0f, {1.0f, 0.5f, 0.0f});
+		DebugDrawSubsystem->QueueSphere(PivotLagLocation, CameraYawRotation.Quaternion(), 16.0f, {1.0f, 0.5f, 0.0f});
 	}
 #endif
 
@@ -270,11 +272,10 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 #if ENABLE_DRAW_DEBUG
 	if (bDisplayDebugCameraShapes)
 	{
-		DrawDebugLine(GetWorld(), PivotLocation, PivotLagLocation,
-		              FLinearColor{0.0f, 0.75f, 1.0f}.ToFColor(true),
-		              false, 0.0f, 0, UAlsUtility::DrawLineThickness);
+		DebugDrawSubsystem->QueueLine(PivotLocation, PivotLagLocation, {0.0f, 0.75f, 1.0f},
+		                              0.0f, UAlsUtility::DrawLineThickness);
 
-		UAlsUtility::DrawDebugSphereAlternative(GetWorld(), PivotLocation, CameraYawRotation, 16.0f, {0.0f, 0.75f, 1.0f});
+		DebugDrawSubsystem->QueueSphere(PivotLocation, CameraYawRotation.Quaternion(), 16.0f, {0.0f, 0.75f, 1.0f});
 	}
 #endif
 
@@ -425,7 +426,10 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
                                                   const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio) const
 {
 #if ENABLE_DRAW_DEBUG
+	auto* DebugDrawSubsystem{GetWorld()->GetSubsystem<UAlsDebugDrawSubsystem>()};
+
 	const auto bDisplayDebugCameraTraces{
+		IsValid(DebugDrawSubsystem) &&
 		UAlsUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraTracesDebugDisplayName())
 	};
 #else
@@ -472,8 +476,8 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 #if ENABLE_DRAW_DEBUG
 	if (bDisplayDebugCameraTraces)
 	{
-		UAlsUtility::DrawDebugSweepSphere(GetWorld(), TraceStart, TraceResult, Settings->ThirdPerson.TraceRadius * MeshScale,
-		                                  Hit.IsValidBlockingHit() ? FLinearColor::Red : FLinearColor::Green);
+		DebugDrawSubsystem->QueueSweepSphere(TraceStart, TraceResult, Settings->ThirdPerson.TraceRadius * MeshScale,
+		                                     Hit.IsValidBlockingHit() ? FLinearColor::Red : FLinearColor::Green);
 	}
 #endif
 
@@ -570,11 +574,11 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 	}
 
 #if ENABLE_DRAW_DEBUG
-	if (bDisplayDebugCameraTraces)
+	auto* DebugDrawSubsystem{bDisplayDebugCameraTraces ? GetWorld()->GetSubsystem<UAlsDebugDrawSubsystem>() : nullptr};
+	if (IsValid(DebugDrawSubsystem))
 	{
-		DrawDebugLine(GetWorld(), Location, Location + Adjustment,
-		              FLinearColor{0.0f, 0.75f, 1.0f}.ToFColor(true),
-		              false, 5.0f, 0, UAlsUtility::DrawLineThickness);
+		DebugDrawSubsystem->QueueLine(Location, Location + Adjustment, {0.0f, 0.75f, 1.0f},
+		                              5.0f, UAlsUtility::DrawLineThickness);
 	}
 #endif
 
@@ -18,7 +18,7 @@ public class ALSEditor : ModuleRules
 		{
 			PrivateDependencyModuleNames.AddRange(new[]
 			{
-				"AnimGraph", "AnimGraphRuntime", "BlueprintGraph"
+				"AnimGraph", "AnimGraphRuntime", "BlueprintGraph", "UnrealEd"
 			});
 		}
 	}
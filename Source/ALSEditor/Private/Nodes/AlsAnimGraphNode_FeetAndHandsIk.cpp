@@ -0,0 +1,28 @@
+#include "Nodes/AlsAnimGraphNode_FeetAndHandsIk.h"
+
+#define LOCTEXT_NAMESPACE "AlsFeetAndHandsIkAnimationGraphNode"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimGraphNode_FeetAndHandsIk)
+
+FText UAlsAnimGraphNode_FeetAndHandsIk::GetTooltipText() const
+{
+	return LOCTEXT("Tooltip", "Applies only the ALS pelvis offset, foot IK and hand IK retargeting without running a control rig."
+	               " Does not perform the spine rotation, diagonal scaling or clamping of foot IK locations by leg length.");
+}
+
+FString UAlsAnimGraphNode_FeetAndHandsIk::GetNodeCategory() const
+{
+	return FString{TEXTVIEW("ALS")};
+}
+
+FText UAlsAnimGraphNode_FeetAndHandsIk::GetControllerDescription() const
+{
+	return LOCTEXT("ControllerDescription", "Feet and Hands IK Only");
+}
+
+const FAnimNode_SkeletalControlBase* UAlsAnimGraphNode_FeetAndHandsIk::GetNode() const
+{
+	return &Node;
+}
+
+#undef LOCTEXT_NAMESPACE
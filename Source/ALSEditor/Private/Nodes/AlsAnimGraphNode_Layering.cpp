@@ -0,0 +1,22 @@
+#include "Nodes/AlsAnimGraphNode_Layering.h"
+
+#define LOCTEXT_NAMESPACE "AlsLayeringAnimationGraphNode"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimGraphNode_Layering)
+
+FText UAlsAnimGraphNode_Layering::GetNodeTitle(const ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("Title", "Layering");
+}
+
+FText UAlsAnimGraphNode_Layering::GetTooltipText() const
+{
+	return LOCTEXT("Tooltip", "Applies all ALS layering blends in a single pass over the pose.");
+}
+
+FString UAlsAnimGraphNode_Layering::GetNodeCategory() const
+{
+	return FString{TEXTVIEW("ALS")};
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,84 @@
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Utility/AlsMath.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AlsMathTest
+{
+	constexpr auto RandomSeed{12345};
+
+	constexpr auto TransformsCount{256};
+
+	// Same as the number of feet transformed together in UAlsAnimationInstance::RefreshFeet(), plus a few more.
+	constexpr auto ValuesCount{5};
+
+	// Without vectorized transforms, FTransform uses scalar math, so the results may differ in the last bits.
+#if ENABLE_VECTORIZED_TRANSFORM
+	constexpr auto Tolerance{0.0};
+#else
+	constexpr auto Tolerance{UE_KINDA_SMALL_NUMBER};
+#endif
+
+	FQuat MakeRandomRotation(FRandomStream& Random)
+	{
+		return FQuat{Random.GetUnitVector(), Random.FRandRange(-UE_PI, UE_PI)};
+	}
+
+	FVector MakeRandomLocation(FRandomStream& Random)
+	{
+		return Random.GetUnitVector() * Random.FRandRange(0.0f, 100000.0f);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAlsTransformLocationsAndRotationsTest, "Als.Math.TransformLocationsAndRotations",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAlsTransformLocationsAndRotationsTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random{AlsMathTest::RandomSeed};
+
+	for (auto i{0}; i < AlsMathTest::TransformsCount; i++)
+	{
+		// Inverse transforms are tested, because that is how UAlsAnimationInstance::RefreshFeet() uses this function.
+
+		const auto Transform{
+			FTransform{
+				AlsMathTest::MakeRandomRotation(Random), AlsMathTest::MakeRandomLocation(Random),
+				FVector{Random.FRandRange(0.5f, 2.0f), Random.FRandRange(0.5f, 2.0f), Random.FRandRange(0.5f, 2.0f)}
+			}.Inverse()
+		};
+
+		FVector Locations[AlsMathTest::ValuesCount];
+		FQuat Rotations[AlsMathTest::ValuesCount];
+
+		for (auto j{0}; j < AlsMathTest::ValuesCount; j++)
+		{
+			Locations[j] = AlsMathTest::MakeRandomLocation(Random);
+			Rotations[j] = AlsMathTest::MakeRandomRotation(Random);
+		}
+
+		FVector TransformedLocations[AlsMathTest::ValuesCount];
+		FQuat TransformedRotations[AlsMathTest::ValuesCount];
+
+		UAlsMath::TransformLocationsAndRotations(Transform, Locations, Rotations, TransformedLocations, TransformedRotations);
+
+		for (auto j{0}; j < AlsMathTest::ValuesCount; j++)
+		{
+			const auto ExpectedLocation{Transform.TransformPosition(Locations[j])};
+			const auto ExpectedRotation{Transform.TransformRotation(Rotations[j])};
+
+			if (!TestTrue(FString::Printf(TEXT("Location %d of transform %d matches FTransform::TransformPosition()"), j, i),
+			              TransformedLocations[j].Equals(ExpectedLocation, AlsMathTest::Tolerance)) ||
+			    !TestTrue(FString::Printf(TEXT("Rotation %d of transform %d matches FTransform::TransformRotation()"), j, i),
+			              TransformedRotations[j].Equals(ExpectedRotation, AlsMathTest::Tolerance)))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,344 @@
+#include "AlsCharacter.h"
+#include "AlsCharacterMovementComponent.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationEditorCommon.h"
+#include "Utility/AlsGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Runs a dedicated server and several autonomous proxy clients in a single editor process, connected through the
+// loopback net drivers of a multiplayer play in editor session. The clients are driven by scripted inputs, and the
+// server move processing statistics of all characters are appended as a single row to a CSV file.
+//
+// The current editor map is used unless another map is specified with -AlsNetworkBenchmarkMap=. The map's game mode
+// must spawn an ALS character for each player. The measurement duration can be changed with -AlsNetworkBenchmarkDuration=
+// and the CSV file path with -AlsNetworkBenchmarkCsv=. By default, the results are saved to Saved/Als/NetworkBenchmark.csv.
+
+namespace AlsNetworkBenchmark
+{
+	constexpr int32 ClientsCounts[]{1, 4, 16, 32};
+
+	constexpr auto DefaultDuration{30.0};
+
+	constexpr auto WarmUpDuration{5.0};
+
+	constexpr auto PlayersTimeout{60.0};
+
+	// Characters turn at this rate while moving, so they keep changing direction and speed.
+	constexpr auto TurnSpeed{45.0};
+
+	// Every step of the script lasts this long. The script cycles through walking, running, sprinting, and crouching.
+	constexpr auto ScriptStepDuration{4.0};
+
+	constexpr auto ScriptStepsCount{4};
+
+	UWorld* FindServerWorld()
+	{
+		for (const auto& WorldContext : GEngine->GetWorldContexts())
+		{
+			auto* World{WorldContext.World()};
+
+			if (WorldContext.WorldType == EWorldType::PIE && IsValid(World) && World->GetNetMode() == NM_DedicatedServer)
+			{
+				return World;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void GetServerCharacters(TArray<AAlsCharacter*>& Characters)
+	{
+		Characters.Reset();
+
+		auto* World{FindServerWorld()};
+		if (!IsValid(World))
+		{
+			return;
+		}
+
+		for (TActorIterator<AAlsCharacter> Iterator{World}; Iterator; ++Iterator)
+		{
+			if (Iterator->GetRemoteRole() == ROLE_AutonomousProxy)
+			{
+				Characters.Add(*Iterator);
+			}
+		}
+	}
+
+	void GetClientCharacters(TArray<AAlsCharacter*>& Characters)
+	{
+		Characters.Reset();
+
+		for (const auto& WorldContext : GEngine->GetWorldContexts())
+		{
+			const auto* World{WorldContext.World()};
+
+			if (WorldContext.WorldType != EWorldType::PIE || !IsValid(World) || World->GetNetMode() != NM_Client)
+			{
+				continue;
+			}
+
+			for (auto Iterator{World->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+			{
+				const auto* PlayerController{Iterator->Get()};
+				auto* Character{IsValid(PlayerController) ? Cast<AAlsCharacter>(PlayerController->GetPawn()) : nullptr};
+
+				if (IsValid(Character) && Character->IsLocallyControlled())
+				{
+					Characters.Add(Character);
+				}
+			}
+		}
+	}
+
+	void DriveCharacter(AAlsCharacter* Character, const int32 CharacterIndex, const int32 CharactersCount, const double Time)
+	{
+		// Spread the characters out, so that they do not all move in the same direction at the same time.
+
+		const auto YawAngle{FMath::Fmod(Time * TurnSpeed + CharacterIndex * 360.0 / CharactersCount, 360.0)};
+
+		Character->AddMovementInput(FRotator{0.0, YawAngle, 0.0}.Vector());
+
+		switch (FMath::FloorToInt32(Time / ScriptStepDuration + CharacterIndex) % ScriptStepsCount)
+		{
+			case 0:
+				Character->SetDesiredStance(AlsStanceTags::Standing);
+				Character->SetDesiredGait(AlsGaitTags::Walking);
+				break;
+
+			case 1:
+				Character->SetDesiredStance(AlsStanceTags::Standing);
+				Character->SetDesiredGait(AlsGaitTags::Running);
+				break;
+
+			case 2:
+				Character->SetDesiredStance(AlsStanceTags::Standing);
+				Character->SetDesiredGait(AlsGaitTags::Sprinting);
+				break;
+
+			default:
+				Character->SetDesiredStance(AlsStanceTags::Crouching);
+				Character->SetDesiredGait(AlsGaitTags::Running);
+				break;
+		}
+	}
+
+	void WriteResults(const FString& CsvFilePath, const int32 ClientsCount, const double Duration,
+	                  const TArray<AAlsCharacter*>& ServerCharacters)
+	{
+		FAlsServerMoveStatistics Totals;
+
+		for (const auto* Character : ServerCharacters)
+		{
+			const auto& Statistics{Character->GetAlsCharacterMovement()->GetServerMoveStatistics()};
+
+			Totals.MoveAutonomousCycles += Statistics.MoveAutonomousCycles;
+			Totals.PhysWalkingCycles += Statistics.PhysWalkingCycles;
+			Totals.ComputeFloorDistCycles += Statistics.ComputeFloorDistCycles;
+			Totals.MovesCount += Statistics.MovesCount;
+			Totals.MovePacketsCount += Statistics.MovePacketsCount;
+			Totals.MovePacketsBytes += Statistics.MovePacketsBytes;
+			Totals.CorrectionsCount += Statistics.CorrectionsCount;
+		}
+
+		const auto MoveAutonomousTime{FPlatformTime::ToMilliseconds64(Totals.MoveAutonomousCycles)};
+		const auto PhysWalkingTime{FPlatformTime::ToMilliseconds64(Totals.PhysWalkingCycles)};
+		const auto ComputeFloorDistTime{FPlatformTime::ToMilliseconds64(Totals.ComputeFloorDistCycles)};
+
+		const auto MovesCount{FMath::Max(1, Totals.MovesCount)};
+
+		auto Csv{
+			FString::Printf(TEXT("%d,%.2f,%d,%d,%lld,%.2f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f") LINE_TERMINATOR,
+			                ClientsCount, Duration, Totals.MovesCount, Totals.MovePacketsCount, Totals.MovePacketsBytes,
+			                static_cast<double>(Totals.MovePacketsBytes) / MovesCount, Totals.CorrectionsCount,
+			                MoveAutonomousTime, PhysWalkingTime, ComputeFloorDistTime,
+			                MoveAutonomousTime * 1000.0 / MovesCount, PhysWalkingTime * 1000.0 / MovesCount,
+			                ComputeFloorDistTime * 1000.0 / MovesCount)
+		};
+
+		if (!IFileManager::Get().FileExists(*CsvFilePath))
+		{
+			Csv = TEXT("Clients,Duration,Moves,MovePackets,MovePacketsBytes,BytesPerMove,Corrections,")
+			      TEXT("MoveAutonomousMs,PhysWalkingMs,ComputeFloorDistMs,")
+			      TEXT("MoveAutonomousUsPerMove,PhysWalkingUsPerMove,ComputeFloorDistUsPerMove") LINE_TERMINATOR + Csv;
+		}
+
+		FFileHelper::SaveStringToFile(Csv, *CsvFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+		                              &IFileManager::Get(), FILEWRITE_Append);
+	}
+}
+
+class FAlsNetworkBenchmarkCommand : public IAutomationLatentCommand
+{
+private:
+	enum class EStage : uint8
+	{
+		WaitingForPlayers,
+		WarmingUp,
+		Measuring
+	};
+
+	FAutomationTestBase* Test;
+
+	int32 ClientsCount;
+
+	double Duration;
+
+	FString CsvFilePath;
+
+	EStage Stage{EStage::WaitingForPlayers};
+
+	double StageStartTime{FPlatformTime::Seconds()};
+
+	TArray<AAlsCharacter*> ServerCharacters;
+
+	TArray<AAlsCharacter*> ClientCharacters;
+
+public:
+	FAlsNetworkBenchmarkCommand(FAutomationTestBase* NewTest, const int32 NewClientsCount,
+	                            const double NewDuration, const FString& NewCsvFilePath)
+		: Test{NewTest},
+		  ClientsCount{NewClientsCount},
+		  Duration{NewDuration},
+		  CsvFilePath{NewCsvFilePath} {}
+
+	virtual bool Update() override
+	{
+		const auto Time{FPlatformTime::Seconds()};
+		const auto StageTime{Time - StageStartTime};
+
+		AlsNetworkBenchmark::GetServerCharacters(ServerCharacters);
+		AlsNetworkBenchmark::GetClientCharacters(ClientCharacters);
+
+		if (Stage == EStage::WaitingForPlayers)
+		{
+			if (ServerCharacters.Num() >= ClientsCount && ClientCharacters.Num() >= ClientsCount)
+			{
+				Stage = EStage::WarmingUp;
+				StageStartTime = Time;
+				return false;
+			}
+
+			if (StageTime > AlsNetworkBenchmark::PlayersTimeout)
+			{
+				Test->AddError(FString::Printf(TEXT("Only %d of %d clients possessed an ALS character. Make sure the game mode of the map spawns ALS characters."),
+				                               ClientCharacters.Num(), ClientsCount));
+
+				GEditor->RequestEndPlayMap();
+				return true;
+			}
+
+			return false;
+		}
+
+		if (ServerCharacters.Num() < ClientsCount || ClientCharacters.Num() < ClientsCount)
+		{
+			Test->AddError(TEXT("A client lost its ALS character during the benchmark."));
+
+			GEditor->RequestEndPlayMap();
+			return true;
+		}
+
+		for (auto i{0}; i < ClientCharacters.Num(); i++)
+		{
+			AlsNetworkBenchmark::DriveCharacter(ClientCharacters[i], i, ClientCharacters.Num(), Time - StageStartTime);
+		}
+
+		if (Stage == EStage::WarmingUp)
+		{
+			if (StageTime >= AlsNetworkBenchmark::WarmUpDuration)
+			{
+				for (auto* Character : ServerCharacters)
+				{
+					Character->GetAlsCharacterMovement()->SetServerMoveStatisticsEnabled(true);
+				}
+
+				Stage = EStage::Measuring;
+				StageStartTime = Time;
+			}
+
+			return false;
+		}
+
+		if (StageTime < Duration)
+		{
+			return false;
+		}
+
+		AlsNetworkBenchmark::WriteResults(CsvFilePath, ClientsCount, StageTime, ServerCharacters);
+
+		for (auto* Character : ServerCharacters)
+		{
+			Character->GetAlsCharacterMovement()->SetServerMoveStatisticsEnabled(false);
+		}
+
+		Test->AddInfo(FString::Printf(TEXT("Results saved to %s."), *CsvFilePath));
+
+		GEditor->RequestEndPlayMap();
+		return true;
+	}
+};
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAlsNetworkBenchmarkTest, "Als.Networking.Benchmark",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FAlsNetworkBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const auto ClientsCount : AlsNetworkBenchmark::ClientsCounts)
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Clients"), ClientsCount));
+		OutTestCommands.Add(FString::FromInt(ClientsCount));
+	}
+}
+
+bool FAlsNetworkBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const auto ClientsCount{FCString::Atoi(*Parameters)};
+
+	if (!TestTrue(TEXT("Clients count is valid"), ClientsCount > 0) ||
+	    !TestFalse(TEXT("Play session is not in progress"), GEditor->IsPlaySessionInProgress()))
+	{
+		return false;
+	}
+
+	FString MapPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("AlsNetworkBenchmarkMap="), MapPath))
+	{
+		FAutomationEditorCommonUtils::LoadMap(MapPath);
+	}
+
+	auto Duration{AlsNetworkBenchmark::DefaultDuration};
+	FParse::Value(FCommandLine::Get(), TEXT("AlsNetworkBenchmarkDuration="), Duration);
+
+	FString CsvFilePath{FPaths::ProjectSavedDir() / TEXT("Als") / TEXT("NetworkBenchmark.csv")};
+	FParse::Value(FCommandLine::Get(), TEXT("AlsNetworkBenchmarkCsv="), CsvFilePath);
+
+	// A client play net mode runs a dedicated server in the same process, and every client connects to it over a loopback net driver.
+
+	auto* PlaySettings{NewObject<ULevelEditorPlaySettings>()};
+	PlaySettings->SetPlayNetMode(PIE_Client);
+	PlaySettings->SetPlayNumberOfClients(ClientsCount);
+	PlaySettings->SetRunUnderOneProcess(true);
+
+	FRequestPlaySessionParams PlaySessionParams;
+	PlaySessionParams.EditorPlaySettings = PlaySettings;
+	PlaySessionParams.SessionDestination = EPlaySessionDestinationType::InProcess;
+
+	GEditor->RequestPlaySession(PlaySessionParams);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAlsNetworkBenchmarkCommand(this, ClientsCount, FMath::Max(1.0, Duration), CsvFilePath));
+
+	return true;
+}
+
+#endif
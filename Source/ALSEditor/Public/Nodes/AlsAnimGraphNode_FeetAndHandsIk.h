@@ -0,0 +1,25 @@
+#pragma once
+
+#include "AnimGraphNode_SkeletalControlBase.h"
+#include "Nodes/AlsAnimNode_FeetAndHandsIk.h"
+#include "AlsAnimGraphNode_FeetAndHandsIk.generated.h"
+
+UCLASS()
+class ALSEDITOR_API UAlsAnimGraphNode_FeetAndHandsIk : public UAnimGraphNode_SkeletalControlBase
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsAnimNode_FeetAndHandsIk Node;
+
+public:
+	virtual FText GetTooltipText() const override;
+
+	virtual FString GetNodeCategory() const override;
+
+protected:
+	virtual FText GetControllerDescription() const override;
+
+	virtual const FAnimNode_SkeletalControlBase* GetNode() const override;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "AnimGraphNode_Base.h"
+#include "Nodes/AlsAnimNode_Layering.h"
+#include "AlsAnimGraphNode_Layering.generated.h"
+
+UCLASS()
+class ALSEDITOR_API UAlsAnimGraphNode_Layering : public UAnimGraphNode_Base
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsAnimNode_Layering Node;
+
+public:
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+
+	virtual FText GetTooltipText() const override;
+
+	virtual FString GetNodeCategory() const override;
+};